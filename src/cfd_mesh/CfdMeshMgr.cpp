@@ -18,11 +18,16 @@
 #include "Util.h"
 #include "SubSurfaceMgr.h"
 #include "SubSurface.h"
+#include "ThreadUtil.h"
+#include "PntNodeMerge.h"
 
 #ifdef DEBUG_CFD_MESH
 #include <direct.h>
 #endif
 
+//==== Border Pnts Shared By Adjacent Surfs Are Copies, So Weld Only Near Exact Matches ====//
+const double PNT_WELD_TOL = 1.0e-12;
+
 //=============================================================//
 Wake::Wake( WakeMgr* mgr )
 {
@@ -404,7 +409,8 @@ CfdMeshMgrSingleton::CfdMeshMgrSingleton() : ParmContainer()
 
     m_BatchFlag = false;
 
-
+    m_OutputThreadID = std::this_thread::get_id();
+    m_OutputType = CFD_OUTPUT;
 
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
@@ -439,16 +445,19 @@ void CfdMeshMgrSingleton::ParmChanged( Parm* parm_ptr, int type )
 
 void CfdMeshMgrSingleton::GenerateMesh()
 {
+    BeginOutput( CFD_OUTPUT );
+
+#ifdef DEBUG_CFD_MESH
     CfdMeshMgr.addOutputText( "Writing Bezier File\n" );
-//  string bezTempFile = m_Vehicle->getTempDir();
-    string bezTempFile;
+    string bezTempFile = m_DebugDir.get_char_star();
     bezTempFile.append( string( "cfdmesh.bez" ) );
 
     CfdMeshMgr.WriteSurfs( bezTempFile );
+#endif
 
     CfdMeshMgr.CleanUp();
-    CfdMeshMgr.addOutputText( "Reading Surfaces\n" );
-    CfdMeshMgr.ReadSurfs( bezTempFile );
+    CfdMeshMgr.addOutputText( "Loading Surfaces\n" );
+    CfdMeshMgr.FetchSurfs();
 
     if ( m_SurfVec.size() == 0 )
     {
@@ -585,12 +594,52 @@ void CfdMeshMgrSingleton::CleanUp()
 
 
 
+//==== Screen Message For CFD Or FEA Output ====//
+string CfdMeshMgrSingleton::OutputMessageName( int output_type )
+{
+    if ( output_type == FEA_OUTPUT )
+    {
+        return string( "FEAMessage" );
+    }
+    return string( "CFDMessage" );
+}
+
+//==== Thread Starting A Run Owns Output Until The Next Run Starts ====//
+void CfdMeshMgrSingleton::BeginOutput( int output_type )
+{
+    //==== Anything Left From The Last Run Goes Out As That Run's Type ====//
+    MessageData data;
+    {
+        std::lock_guard< std::mutex > lock( m_OutputMutex );
+        data.m_String = OutputMessageName( m_OutputType );
+        data.m_StringVec.swap( m_PendingOutput );
+
+        m_OutputThreadID = std::this_thread::get_id();
+        m_OutputType = output_type;
+    }
+
+    if ( data.m_StringVec.size() )
+    {
+        MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+    }
+}
+
 void CfdMeshMgrSingleton::addOutputText( const string &str, int output_type )
 {
 //    m_OutStream << str;
 
+    //==== Screens Are Only Updated From The Owning Thread ====//
+    if ( std::this_thread::get_id() != m_OutputThreadID )
+    {
+        std::lock_guard< std::mutex > lock( m_OutputMutex );
+        m_PendingOutput.push_back( str );
+        return;
+    }
+
+    FlushOutputText();
+
     MessageData data;
-    data.m_String = "CFDMessage";
+    data.m_String = OutputMessageName( output_type );
     data.m_StringVec.push_back( str );
     MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
 
@@ -610,6 +659,26 @@ void CfdMeshMgrSingleton::addOutputText( const string &str, int output_type )
 //        }
 }
 
+void CfdMeshMgrSingleton::FlushOutputText()
+{
+    if ( std::this_thread::get_id() != m_OutputThreadID )
+    {
+        return;
+    }
+
+    MessageData data;
+    {
+        std::lock_guard< std::mutex > lock( m_OutputMutex );
+        data.m_String = OutputMessageName( m_OutputType );
+        data.m_StringVec.swap( m_PendingOutput );
+    }
+
+    if ( data.m_StringVec.size() )
+    {
+        MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+    }
+}
+
 void CfdMeshMgrSingleton::AdjustAllSourceLen( double mult )
 {
     vector<string> geomVec = m_Vehicle->GetGeomVec();
@@ -1022,6 +1091,58 @@ void CfdMeshMgrSingleton::WriteSurfs( const string &filename )
 }
 
 
+//==== Build Surfs Directly From Each Geom's VspSurfs ====//
+void CfdMeshMgrSingleton::FetchSurfs()
+{
+    m_GeomIDs.clear();
+    m_NumComps = 0;
+
+    vector< Geom* > geom_vec = m_Vehicle->FindGeomVec( m_Vehicle->GetGeomVec( false ) );
+    int write_set = GetCfdSettingsPtr()->m_SelectedSetIndex();
+
+    int total_surfs = 0;
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if( !geom_vec[i]->GetSetFlag( write_set ) )
+        {
+            continue;
+        }
+
+        vector< VspSurf > surf_vec;
+        geom_vec[i]->GetSurfVec( surf_vec );
+
+        for ( int j = 0 ; j < ( int )surf_vec.size() ; j++ )
+        {
+            int c = m_NumComps;
+            m_NumComps++;
+
+            string geom_id = geom_vec[i]->GetID();
+            m_GeomIDs.push_back( geom_id );
+
+            vector< BezSection > sect_vec;
+            surf_vec[j].FetchBezSections( sect_vec );
+
+            for ( int s = 0 ; s < ( int )sect_vec.size() ; s++ )
+            {
+                Surf* surfPtr = new Surf();
+
+                surfPtr->SetGeomID( geom_id );
+                surfPtr->SetCompID( c );
+                surfPtr->SetUnmergedCompID( c );
+                surfPtr->SetSurfID( s + total_surfs );
+                surfPtr->SetFlipFlag( surf_vec[j].GetFlipNormal() );
+
+                surfPtr->LoadBezSection( sect_vec[s], j );
+
+                AddLoadedSurf( surfPtr );
+            }
+            total_surfs += sect_vec.size();
+        }
+    }
+
+    MergeLoadedSurfs();
+}
+
 void CfdMeshMgrSingleton::ReadSurfs( const string &filename )
 {
     m_GeomIDs.clear();
@@ -1061,31 +1182,42 @@ void CfdMeshMgrSingleton::ReadSurfs( const string &filename )
 
                 surfPtr->ReadSurf( file_id );
 
-                bool addSurfFlag = true;
-                if ( GetCfdSettingsPtr()->GetHalfMeshFlag() && surfPtr->LessThanY( 1e-6 ) )
-                {
-                    addSurfFlag = false;
-                }
-
-                if ( GetCfdSettingsPtr()->GetHalfMeshFlag() && surfPtr->PlaneAtYZero() )
-                {
-                    addSurfFlag = false;
-                }
-
-                if ( addSurfFlag )
-                {
-                    m_SurfVec.push_back( surfPtr );
-                }
-                else
-                {
-                    delete surfPtr;
-                }
+                AddLoadedSurf( surfPtr );
             }
             total_surfs += num_surfs;
         }
         fclose( file_id );
     }
 
+    MergeLoadedSurfs();
+}
+
+//==== Add Surf Unless Removed By Half Mesh ====//
+void CfdMeshMgrSingleton::AddLoadedSurf( Surf* surfPtr )
+{
+    bool addSurfFlag = true;
+    if ( GetCfdSettingsPtr()->GetHalfMeshFlag() && surfPtr->LessThanY( 1e-6 ) )
+    {
+        addSurfFlag = false;
+    }
+
+    if ( GetCfdSettingsPtr()->GetHalfMeshFlag() && surfPtr->PlaneAtYZero() )
+    {
+        addSurfFlag = false;
+    }
+
+    if ( addSurfFlag )
+    {
+        m_SurfVec.push_back( surfPtr );
+    }
+    else
+    {
+        delete surfPtr;
+    }
+}
+
+void CfdMeshMgrSingleton::MergeLoadedSurfs()
+{
     DeleteDuplicateSurfs();
 
     //==== Combine Components With Matching Surface Edges ====//
@@ -1362,8 +1494,12 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
     char str[256];
     int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
-    for ( int i = 0 ; i < nsurf ; i++ )
+
+    //==== Each Mesh Only Touches Its Own Surf, So Remesh Surfs Concurrently ====//
+    vector< int > num_tris_vec( nsurf, 0 );
+    ThreadUtil::ParallelFor( nsurf, [&]( int i, int thread_index )
     {
+        char surf_str[256];
         int num_tris = 0;
 
         for ( int iter = 0 ; iter < 10 ; iter++ )
@@ -1374,16 +1510,24 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
 
             num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
 
-            sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
+            sprintf( surf_str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
             if ( output_type != CfdMeshMgrSingleton::NO_OUTPUT )
             {
-                addOutputText( str, output_type );
+                addOutputText( surf_str, output_type );
             }
         }
-        total_num_tris += num_tris;
+        num_tris_vec[i] = num_tris;
 
         m_SurfVec[i]->GetMesh()->LoadSimpTris();
         m_SurfVec[i]->GetMesh()->Clear();
+    } );
+    FlushOutputText();
+
+    //==== Subtagging Queries Shared Sub-Surface Data ====//
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        total_num_tris += num_tris_vec[i];
+
         m_SurfVec[i]->Subtag( GetCfdSettingsPtr()->GetIntersectSubSurfs() );
         m_SurfVec[i]->GetMesh()->CondenseSimpTris();
     }
@@ -1566,33 +1710,30 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     }
 
     int tri_cnt = 0;
-    vector< vec3d* > allPntVec;
+    vector< vec3d > allPntVec;
+    vector< int > pntOffset( m_SurfVec.size() );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-        {
-            allPntVec.push_back( &sPntVec[v] );
-        }
+        pntOffset[i] = ( int )allPntVec.size();
+        allPntVec.insert( allPntVec.end(), sPntVec.begin(), sPntVec.end() );
         tri_cnt += m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
     }
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    int numPnts = BuildIndMap( allPntVec, indMap, pntShift );
+    //==== Weld Shared Border Pnts ====//
+    vector< int > pntMap;
+    vector< int > usedPntVec;
+    int numPnts = WeldPnts( allPntVec, PNT_WELD_TOL, pntMap, usedPntVec );
 
     //===== Write Num Pnts and Tris ====//
     fprintf( fp, "# Part 1 - node list\n" );
     fprintf( fp, "%d 3 0 0\n", numPnts );
 
     //==== Write Model Pnts ====//
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )usedPntVec.size() ; i++ )
     {
-        if ( pntShift[i] >= 0 )
-        {
-            fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, allPntVec[i]->x(), allPntVec[i]->y(), allPntVec[i]->z() );
-        }
+        vec3d& p = allPntVec[ usedPntVec[i] ];
+        fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, p.x(), p.y(), p.z() );
     }
 
     //==== Write Tris ====//
@@ -1602,15 +1743,11 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-        vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
         for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
         {
-            int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-            int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-            int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-            int ind1 = pntShift[i0] + 1;
-            int ind2 = pntShift[i1] + 1;
-            int ind3 = pntShift[i2] + 1;
+            int ind1 = pntMap[ pntOffset[i] + sTriVec[t].ind0 ] + 1;
+            int ind2 = pntMap[ pntOffset[i] + sTriVec[t].ind1 ] + 1;
+            int ind3 = pntMap[ pntOffset[i] + sTriVec[t].ind2 ] + 1;
 
             fprintf( fp, "1\n" );
             fprintf( fp, "3 %d %d %d\n", ind1, ind2, ind3 );
@@ -1711,37 +1848,26 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
 //      return;
 
     //==== Find All Points and Tri Counts ====//
-    vector< vec3d* > allPntVec;
-    vector< vec3d* > wakeAllPntVec;
+    vector< vec3d > allPntVec;
+    vector< vec3d > wakeAllPntVec;
+    vector< int > pntOffset( m_SurfVec.size() );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-        for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-        {
-            if ( m_SurfVec[i]->GetWakeFlag() )
-            {
-                wakeAllPntVec.push_back( &sPntVec[v] );
-            }
-            else
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
-        }
+        vector< vec3d >& destPntVec = m_SurfVec[i]->GetWakeFlag() ? wakeAllPntVec : allPntVec;
+        pntOffset[i] = ( int )destPntVec.size();
+        destPntVec.insert( destPntVec.end(), sPntVec.begin(), sPntVec.end() );
     }
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
+    //==== Weld Shared Border Pnts ====//
+    vector< int > pntMap;
+    vector< int > usedPntVec;
+    WeldPnts( allPntVec, PNT_WELD_TOL, pntMap, usedPntVec );
 
-    //==== Build Wake Map If Available ====//
-    map< int, vector< int > > wakeIndMap;
-    vector< int > wakePntShift;
-    int wakeNumPnts = 0;
-    if ( wakeAllPntVec.size() )
-    {
-        wakeNumPnts = BuildIndMap( wakeAllPntVec, wakeIndMap, wakePntShift );
-    }
+    //==== Weld Wake Pnts Separately ====//
+    vector< int > wakePntMap;
+    vector< int > wakeUsedPntVec;
+    WeldPnts( wakeAllPntVec, PNT_WELD_TOL, wakePntMap, wakeUsedPntVec );
 
     //==== Assemble Normal Tris ====//
     vector< SimpTri > allTriVec;
@@ -1751,16 +1877,12 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         if ( !m_SurfVec[i]->GetWakeFlag() )
         {
             vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
                 SimpTri stri;
-                stri.ind0 = pntShift[i0] + 1;
-                stri.ind1 = pntShift[i1] + 1;
-                stri.ind2 = pntShift[i2] + 1;
+                stri.ind0 = pntMap[ pntOffset[i] + sTriVec[t].ind0 ] + 1;
+                stri.ind1 = pntMap[ pntOffset[i] + sTriVec[t].ind1 ] + 1;
+                stri.ind2 = pntMap[ pntOffset[i] + sTriVec[t].ind2 ] + 1;
                 stri.m_Tags = sTriVec[t].m_Tags;
                 allTriVec.push_back( stri );
                 allSurfIDVec.push_back( m_SurfVec[i]->GetSurfID() );
@@ -1769,12 +1891,9 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     }
     //==== Assemble All Used Points ====//
     vector< vec3d* > allUsedPntVec;
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )usedPntVec.size() ; i++ )
     {
-        if ( pntShift[i] >= 0 )
-        {
-            allUsedPntVec.push_back( allPntVec[i] );
-        }
+        allUsedPntVec.push_back( &allPntVec[ usedPntVec[i] ] );
     }
 
     //==== Assemble Wake Tris ====//
@@ -1784,16 +1903,12 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         if ( m_SurfVec[i]->GetWakeFlag() )
         {
             vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], wakeAllPntVec, wakeIndMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], wakeAllPntVec, wakeIndMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], wakeAllPntVec, wakeIndMap );
                 SimpTri stri;
-                stri.ind0 = wakePntShift[i0] + 1 + wakeIndOffset;
-                stri.ind1 = wakePntShift[i1] + 1 + wakeIndOffset;
-                stri.ind2 = wakePntShift[i2] + 1 + wakeIndOffset;
+                stri.ind0 = wakePntMap[ pntOffset[i] + sTriVec[t].ind0 ] + 1 + wakeIndOffset;
+                stri.ind1 = wakePntMap[ pntOffset[i] + sTriVec[t].ind1 ] + 1 + wakeIndOffset;
+                stri.ind2 = wakePntMap[ pntOffset[i] + sTriVec[t].ind2 ] + 1 + wakeIndOffset;
                 stri.m_Tags = sTriVec[t].m_Tags;
                 allTriVec.push_back( stri );
                 allSurfIDVec.push_back( m_SurfVec[i]->GetSurfID() );
@@ -1802,12 +1917,9 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     }
 
     //==== Assemble All Used Points ====//
-    for ( int i = 0 ; i < ( int )wakeAllPntVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )wakeUsedPntVec.size() ; i++ )
     {
-        if ( wakePntShift[i] >= 0 )
-        {
-            allUsedPntVec.push_back( wakeAllPntVec[i] );
-        }
+        allUsedPntVec.push_back( &wakeAllPntVec[ wakeUsedPntVec[i] ] );
     }
 
     //=====================================================================================//
@@ -2110,34 +2222,30 @@ string CfdMeshMgrSingleton::CheckWaterTight()
     vector< Tri* > triVec;
 
     int tri_cnt = 0;
-    vector< vec3d* > allPntVec;
+    vector< vec3d > allPntVec;
+    vector< int > pntOffset( m_SurfVec.size() );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         if ( m_SurfVec[i]->GetWakeFlag() == false )
         {
             vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
+            pntOffset[i] = ( int )allPntVec.size();
+            allPntVec.insert( allPntVec.end(), sPntVec.begin(), sPntVec.end() );
             tri_cnt += m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
         }
     }
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
+    //==== Weld Shared Border Pnts ====//
+    vector< int > pntMap;
+    vector< int > usedPntVec;
+    WeldPnts( allPntVec, PNT_WELD_TOL, pntMap, usedPntVec );
 
     //==== Create Nodes ====//
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )usedPntVec.size() ; i++ )
     {
-        if ( pntShift[i] >= 0 )
-        {
-            Node* n = new Node();
-            n->pnt = *allPntVec[i];
-            m_nodeStore.push_back( n );
-        }
+        Node* n = new Node();
+        n->pnt = allPntVec[ usedPntVec[i] ];
+        m_nodeStore.push_back( n );
     }
 
     //==== Create Edges and Tris ====//
@@ -2148,15 +2256,11 @@ string CfdMeshMgrSingleton::CheckWaterTight()
         if ( m_SurfVec[i]->GetWakeFlag() == false )
         {
             vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
             for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
             {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-                int ind1 = pntShift[i0];
-                int ind2 = pntShift[i1];
-                int ind3 = pntShift[i2];
+                int ind1 = pntMap[ pntOffset[i] + sTriVec[t].ind0 ];
+                int ind2 = pntMap[ pntOffset[i] + sTriVec[t].ind1 ];
+                int ind3 = pntMap[ pntOffset[i] + sTriVec[t].ind2 ];
 
                 Edge* e0 = FindAddEdge( edgeMap, m_nodeStore, ind1, ind2 );
                 Edge* e1 = FindAddEdge( edgeMap, m_nodeStore, ind2, ind3 );
@@ -2371,11 +2475,7 @@ void CfdMeshMgrSingleton::Intersect()
     if ( GetCfdSettingsPtr()->GetIntersectSubSurfs() ) BuildSubSurfIntChains();
 
     //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
-        {
-            m_SurfVec[i]->Intersect( m_SurfVec[j] );
-        }
+    IntersectSurfPairs();
 
 
     BuildChains();
@@ -2391,6 +2491,79 @@ void CfdMeshMgrSingleton::Intersect()
     BuildCurves();
 }
 
+//==== Intersect All Surface Pairs - Patch Intersection Runs Concurrently ====//
+void CfdMeshMgrSingleton::IntersectSurfPairs()
+{
+    vector< pair< int, int > > cand_vec;
+    FindCandidateSurfPairs( cand_vec );
+
+    //==== Co-Planar Border Checks Modify Surf Curves - Keep Serial and In Order ====//
+    vector< pair< int, int > > pair_vec;
+    for ( int p = 0 ; p < ( int )cand_vec.size() ; p++ )
+    {
+        if ( m_SurfVec[ cand_vec[p].first ]->PrepIntersect( m_SurfVec[ cand_vec[p].second ] ) )
+        {
+            pair_vec.push_back( cand_vec[p] );
+        }
+    }
+
+    //==== Each Pair Fills Its Own Segment Buffer ====//
+    vector< vector< IntersectSeg > > pair_seg_vec( pair_vec.size() );
+    ThreadUtil::ParallelFor( ( int )pair_vec.size(), [&]( int p, int thread_index )
+    {
+        m_SurfVec[ pair_vec[p].first ]->IntersectPatches( m_SurfVec[ pair_vec[p].second ], &pair_seg_vec[p] );
+    } );
+
+    //==== Merge In Pair Order So Results Match Serial Intersection ====//
+    //==== Segments Go To The CfdMeshMgr Singleton, As intersect_quads Sends Them ====//
+    for ( int p = 0 ; p < ( int )pair_seg_vec.size() ; p++ )
+    {
+        for ( int s = 0 ; s < ( int )pair_seg_vec[p].size() ; s++ )
+        {
+            CfdMeshMgr.AddIntersectionSeg( pair_seg_vec[p][s] );
+        }
+    }
+}
+
+//==== Sweep Surf Bounding Boxes Along X - Pairs Returned As ( i < j ) In Index Order ====//
+void CfdMeshMgrSingleton::FindCandidateSurfPairs( vector< pair< int, int > > & pair_vec )
+{
+    pair_vec.clear();
+
+    int nsurf = ( int )m_SurfVec.size();
+
+    vector< pair< double, int > > sweep_vec( nsurf );
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        sweep_vec[i] = pair< double, int >( m_SurfVec[i]->GetBBox().GetMin( 0 ), i );
+    }
+    sort( sweep_vec.begin(), sweep_vec.end() );
+
+    double tol = 1.0e-12;
+    for ( int a = 0 ; a < nsurf ; a++ )
+    {
+        int i = sweep_vec[a].second;
+        double max_x = m_SurfVec[i]->GetBBox().GetMax( 0 ) + tol;
+
+        for ( int b = a + 1 ; b < nsurf && sweep_vec[b].first <= max_x ; b++ )
+        {
+            int j = sweep_vec[b].second;
+
+            if ( m_SurfVec[i]->GetCompID() == m_SurfVec[j]->GetCompID() )
+            {
+                continue;
+            }
+
+            if ( Compare( m_SurfVec[i]->GetBBox(), m_SurfVec[j]->GetBBox() ) )
+            {
+                pair_vec.push_back( pair< int, int >( min( i, j ), max( i, j ) ) );
+            }
+        }
+    }
+
+    sort( pair_vec.begin(), pair_vec.end() );
+}
+
 vector< Surf* > CfdMeshMgrSingleton::CreateDomainSurfs()
 {
     vector < vec3d > p0;
@@ -2564,41 +2737,36 @@ void CfdMeshMgrSingleton::InitMesh( )
 
 void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 )
 {
-    double d = dist_squared( ip0, ip1 );
-    if ( d < DBL_EPSILON )
+    IntersectSeg seg;
+    if ( project_int_seg( pA, pB, ip0, ip1, seg ) )
     {
-        return;
+        AddIntersectionSeg( seg );
     }
+}
 
-    vec2d proj_uwA0;
-    pA.find_closest_uw( ip0, proj_uwA0.v );
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+void CfdMeshMgrSingleton::AddIntersectionSeg( const IntersectSeg & seg )
+{
+    Puw* puwA0 = new Puw( seg.m_SurfA, seg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    vec2d proj_uwB0;
-    pB.find_closest_uw( ip0, proj_uwB0.v );
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( seg.m_SurfB, seg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
-    ipnt0->m_Pnt = ip0;
+    ipnt0->m_Pnt = seg.m_Pnt[0];
     m_DelIPntVec.push_back( ipnt0 );
 
-    vec2d proj_uwA1;
-    pA.find_closest_uw( ip1, proj_uwA1.v );
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( seg.m_SurfA, seg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    vec2d proj_uwB1;
-    pB.find_closest_uw( ip1, proj_uwB1.v );
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( seg.m_SurfB, seg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
-    ipnt1->m_Pnt = ip1;
+    ipnt1->m_Pnt = seg.m_Pnt[1];
     m_DelIPntVec.push_back( ipnt1 );
 
-    ISeg* iseg01 = new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+    ISeg* iseg01 = new ISeg( seg.m_SurfA, seg.m_SurfB, ipnt0, ipnt1 );
 
     int id0 = IPntBin::ComputeID( ipnt0->m_Pnt );
     m_BinMap[id0].m_ID = id0;
@@ -2619,11 +2787,11 @@ void CfdMeshMgrSingleton::AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3
         onetime = false;
     }
 
-    double dA0 = dist( ip0, puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
-    double dB0 = dist( ip0, puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
+    double dA0 = dist( seg.m_Pnt[0], puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
+    double dB0 = dist( seg.m_Pnt[0], puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
 
-    double dA1 = dist( ip1, puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
-    double dB1 = dist( ip1, puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
+    double dA1 = dist( seg.m_Pnt[1], puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
+    double dB1 = dist( seg.m_Pnt[1], puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
 
     double tol = 1.0e-8;
     double total_d = dA0 + dB0 + dA1 + dB1;
@@ -3667,6 +3835,110 @@ void CfdMeshMgrSingleton::BuildMesh()
     }
 }
 
+//==== Shoot Ray From Tri Center and Count Crossings of Each Component ====//
+bool CfdMeshMgrSingleton::TriInteriorRayTest( int s, Tri* tri, double x_dist )
+{
+    int tri_comp_id = m_SurfVec[s]->GetCompID();
+
+    vector< vector< double > > t_vec_vec;
+    t_vec_vec.resize( m_NumComps + 6 );  // + 6 to handle possibility of outer domain and symmetry plane.
+
+    vec3d cp = tri->ComputeCenterPnt( m_SurfVec[s] );
+    vec3d ep = cp + vec3d( x_dist, 0.0001, 0.0001 );
+
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        int comp_id = m_SurfVec[i]->GetCompID();
+        if ( comp_id != tri_comp_id ) // Don't check self intersection.
+        {
+            if ( m_SurfVec[i]->GetTransFlag() == false ) // Don't check against transparent surf.
+            {
+                m_SurfVec[i]->IntersectLineSeg( cp, ep, t_vec_vec[comp_id] );
+            }
+            else if ( m_SurfVec[i]->GetFarFlag() == true && m_SurfVec[s]->GetSymPlaneFlag() == true && GetCfdSettingsPtr()->GetFarCompFlag() == true ) // Unless trimming sym plane by outer domain
+            {
+                m_SurfVec[i]->IntersectLineSeg( cp, ep, t_vec_vec[comp_id] );
+            }
+        }
+    }
+    bool interiorFlag = false;
+
+
+    // Loop over m_SurfVec instead of component id's.  Components will be addressed multiple times,
+    // but it allows access to m_SurfVec[i]->GetFarFlag() without a reverse lookup on component id.
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        int c =  m_SurfVec[i]->GetCompID();
+
+        if ( m_SurfVec[s]->GetSymPlaneFlag() == true && m_SurfVec[i]->GetFarFlag() == true  && GetCfdSettingsPtr()->GetFarCompFlag() == true )
+        {
+            if ( ( int )( t_vec_vec[c].size() + 1 ) % 2 == 1  ) // +1 Reverse action on sym plane wrt outer boundary.
+            {
+                interiorFlag = true;
+            }
+        }
+        else
+        {
+            if ( ( int )t_vec_vec[c].size() % 2 == 1 )
+            {
+                interiorFlag = true;
+            }
+        }
+    }
+
+    return interiorFlag;
+}
+
+//==== Ray Test Every Tri In Region and Vote With Adjoining Tris ====//
+void CfdMeshMgrSingleton::VoteRegionInteriorTris( int s, vector< Tri* > & region, double x_dist )
+{
+    for ( int t = 0 ; t < ( int )region.size() ; t++ )
+    {
+        region[t]->intExtCount = 0;
+    }
+
+    for ( int t = 0 ; t < ( int )region.size() ; t++ )
+    {
+        bool interiorFlag = TriInteriorRayTest( s, region[t], x_dist );
+
+        region[t]->interiorFlag = interiorFlag;
+        //==== Load Adjoining Tris - NOT Crossing Borders ====//
+        set< Tri* > triSet;
+        region[t]->LoadAdjTris( 3, triSet );
+
+        set<Tri*>::iterator st;
+        for ( st = triSet.begin() ; st != triSet.end() ; st++ )
+        {
+            if ( interiorFlag )
+            {
+                ( *st )->intExtCount++;
+            }
+            else
+            {
+                ( *st )->intExtCount--;
+            }
+
+        }
+    }
+
+    //==== Check Vote and Mark Interior Tris =====//
+    for ( int t = 0 ; t < ( int )region.size() ; t++ )
+    {
+        if ( region[t]->intExtCount > 0 )
+        {
+            region[t]->interiorFlag = true;
+        }
+        else if ( region[t]->intExtCount < 0 )
+        {
+            region[t]->interiorFlag = false;
+        }
+        else
+        {
+            printf( "IntExtCount ZERO!\n" );
+        }
+    }
+}
+
 void CfdMeshMgrSingleton::RemoveInteriorTris()
 {
     debugRayIsect.clear();
@@ -3680,99 +3952,48 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     }
     double x_dist = 1.0 + big_box.GetMax( 0 ) - big_box.GetMin( 0 );
 
-    //==== Count Number of Component Crossings for Each Component =====//
-    list< Tri* >::iterator t;
+    bool verify_flag = GetCfdSettingsPtr()->GetVerifyIntRegionsFlag();
+    int num_verify = 4;
+
+    //==== Tris Not Separated By Borders Share Interior/Exterior State - Classify Once Per Region ====//
+    vector< Tri* >::const_iterator t;
     for ( s = 0 ; s < ( int )m_SurfVec.size() ; s++ )
     {
-        int tri_comp_id = m_SurfVec[s]->GetCompID();
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-        for ( t = triList.begin() ; t != triList.end(); t++ )
-        {
-            vector< vector< double > > t_vec_vec;
-            t_vec_vec.resize( m_NumComps + 6 );  // + 6 to handle possibility of outer domain and symmetry plane.
+        vector< vector< Tri* > > region_vec;
+        m_SurfVec[s]->GetMesh()->BuildTriRegions( region_vec );
 
-            vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
-            vec3d ep = cp + vec3d( x_dist, 0.0001, 0.0001 );
-
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-            {
-                int comp_id = m_SurfVec[i]->GetCompID();
-                if ( comp_id != tri_comp_id ) // Don't check self intersection.
-                {
-                    if ( m_SurfVec[i]->GetTransFlag() == false ) // Don't check against transparent surf.
-                    {
-                        m_SurfVec[i]->IntersectLineSeg( cp, ep, t_vec_vec[comp_id] );
-                    }
-                    else if ( m_SurfVec[i]->GetFarFlag() == true && m_SurfVec[s]->GetSymPlaneFlag() == true && GetCfdSettingsPtr()->GetFarCompFlag() == true ) // Unless trimming sym plane by outer domain
-                    {
-                        m_SurfVec[i]->IntersectLineSeg( cp, ep, t_vec_vec[comp_id] );
-                    }
-                }
-            }
-            bool interiorFlag = false;
+        for ( int r = 0 ; r < ( int )region_vec.size() ; r++ )
+        {
+            vector< Tri* > & region = region_vec[r];
 
+            //==== Seed From Middle of Flood Fill Order - Away From Region Start ====//
+            int nreg = ( int )region.size();
+            bool interiorFlag = TriInteriorRayTest( s, region[ nreg / 2 ], x_dist );
 
-            // Loop over m_SurfVec instead of component id's.  Components will be addressed multiple times,
-            // but it allows access to m_SurfVec[i]->GetFarFlag() without a reverse lookup on component id.
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+            bool agree_flag = true;
+            if ( verify_flag )
             {
-                int c =  m_SurfVec[i]->GetCompID();
-
-                if ( m_SurfVec[s]->GetSymPlaneFlag() == true && m_SurfVec[i]->GetFarFlag() == true  && GetCfdSettingsPtr()->GetFarCompFlag() == true )
-                {
-                    if ( ( int )( t_vec_vec[c].size() + 1 ) % 2 == 1  ) // +1 Reverse action on sym plane wrt outer boundary.
-                    {
-                        interiorFlag = true;
-                    }
-                }
-                else
+                for ( int v = 0 ; v < num_verify && agree_flag ; v++ )
                 {
-                    if ( ( int )t_vec_vec[c].size() % 2 == 1 )
+                    int ind = ( ( 2 * v + 1 ) * nreg ) / ( 2 * num_verify );
+                    if ( TriInteriorRayTest( s, region[ind], x_dist ) != interiorFlag )
                     {
-                        interiorFlag = true;
+                        agree_flag = false;
                     }
                 }
             }
 
-
-            ( *t )->interiorFlag = interiorFlag;
-            //==== Load Adjoining Tris - NOT Crossing Borders ====//
-            set< Tri* > triSet;
-            ( *t )->LoadAdjTris( 3, triSet );
-
-            set<Tri*>::iterator st;
-            for ( st = triSet.begin() ; st != triSet.end() ; st++ )
+            if ( agree_flag )
             {
-                if ( interiorFlag )
-                {
-                    ( *st )->intExtCount++;
-                }
-                else
+                for ( int i = 0 ; i < nreg ; i++ )
                 {
-                    ( *st )->intExtCount--;
+                    region[i]->interiorFlag = interiorFlag;
                 }
-
-            }
-        }
-    }
-
-    //==== Check Vote and Mark Interior Tris =====//
-    for ( s = 0 ; s < ( int )m_SurfVec.size() ; s++ )
-    {
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-        for ( t = triList.begin() ; t != triList.end(); t++ )
-        {
-            if ( ( *t )->intExtCount > 0 )
-            {
-                ( *t )->interiorFlag = true;
-            }
-            else if ( ( *t )->intExtCount < 0 )
-            {
-                ( *t )->interiorFlag = false;
             }
             else
             {
-                printf( "IntExtCount ZERO!\n" );
+                //==== Samples Disagree - Fall Back To Per Tri Ray Test and Vote ====//
+                VoteRegionInteriorTris( s, region, x_dist );
             }
         }
     }
@@ -3784,7 +4005,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
         {
             if ( m_SurfVec[s]->GetSymPlaneFlag() == false )
             {
-                list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                const vector< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
                 for ( t = triList.begin() ; t != triList.end(); t++ )
                 {
                     vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
@@ -3799,7 +4020,7 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
             {
                 if ( m_SurfVec[s]->GetSymPlaneFlag() == true )
                 {
-                    list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+                    const vector< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
                     for ( t = triList.begin() ; t != triList.end(); t++ )
                     {
                         ( *t )->interiorFlag = true;
@@ -3820,12 +4041,12 @@ void CfdMeshMgrSingleton::ConnectBorderEdges( bool wakeOnly )
 {
     list< Edge* >::iterator e;
     list< Edge* > edgeList;
-    list< Tri* >::iterator t;
+    vector< Tri* >::const_iterator t;
     for ( int s = 0 ; s < ( int )m_SurfVec.size() ; s++ )
     {
         if ( m_SurfVec[s]->GetWakeFlag() == wakeOnly )
         {
-            list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
+            const vector< Tri* > & triList = m_SurfVec[s]->GetMesh()->GetTriList();
             for ( t = triList.begin() ; t != triList.end(); t++ )
             {
                 if ( ( *t )->e0->OtherTri( ( *t ) ) == NULL )
@@ -3899,7 +4120,7 @@ void CfdMeshMgrSingleton::ConnectBorderEdges( bool wakeOnly )
 
 }
 
-void CfdMeshMgrSingleton::MatchBorderEdges( list< Edge* > edgeList )
+void CfdMeshMgrSingleton::MatchBorderEdges( list< Edge* > & edgeList )
 {
     list< Edge* >::iterator e;
     list< Edge* >::iterator f;
@@ -9,11 +9,13 @@
 //////////////////////////////////////////////////////////////////////
 
 //===== CfdMesh Overview ====//
-//  WriteSurfs: Each component writes out cubic Bezier surfaces (split depending on topology)
+//  WriteSurfs: Each component writes out cubic Bezier surfaces (split depending on topology) - debug dump only
 //
 //  CleanUp: Clear all allocated resources
 //
-//  ReadSurfs: Read Bezier surf from file.  Combine components that have matching border curves.
+//  FetchSurfs: Build Bezier surfs directly from components.  Combine components that have matching border curves.
+//
+//  ReadSurfs: Read Bezier surf from file (FEA and debug path).  Same combine logic as FetchSurfs.
 //
 //  UpdateSourcesAndWakes: Get all sources locations from geom components.  Set up wakes.
 //
@@ -21,8 +23,9 @@
 //              Match SCurves to create ICurves.  Create wakes surfs.
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
+//      CfdMeshMgr::IntersectSurfPairs - Bounding box sweep for candidate pairs, concurrent pair intersection.
 //      Surf::Intersect - subdivide in to patchs, keep splitting till planer, intersect.
-//          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
+//          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments (merged in pair order).
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
 //
@@ -42,10 +45,11 @@
 //
 //      CfdMeshMgr::BuildMesh: For each surface, find chains and build triangle mesh.
 //
-//      CfdMeshMgr::RemoveInteriorTris: For each triangle, shoot ray and count number of crossings.
-//              Remove intierior triangles.
+//      CfdMeshMgr::RemoveInteriorTris: Group triangles into regions bounded by border edges.  For a seed
+//              triangle in each region, shoot ray and count number of crossings.  Remove intierior triangles.
 //
 //      CfdMeshMgr::Remesh: Remesh (split, collapse, swap, smooth) each surface mesh triangle.
+//                          Surfaces are independent once borders are fixed, so they are remeshed concurrently.
 //
 
 
@@ -57,6 +61,7 @@
 //#endif
 
 #include "Surf.h"
+#include "IntersectPatch.h"
 #include "Mesh.h"
 #include "SCurve.h"
 #include "ICurve.h"
@@ -79,6 +84,8 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <mutex>
+#include <thread>
 using namespace std;
 
 class WakeMgr;
@@ -175,7 +182,11 @@ public:
 
     virtual void GenerateMesh();
 
+    //==== Output From Worker Threads Is Queued Until The Owning Thread Reports Again ====//
+    virtual void BeginOutput( int output_type );
     virtual void addOutputText( const string &str, int output_type = CFD_OUTPUT );
+    virtual void FlushOutputText();
+    static string OutputMessageName( int output_type );
 
     virtual void GUI_Val( string name, double val );
     virtual void GUI_Val( string name, int val );
@@ -229,6 +240,9 @@ public:
 
     virtual void WriteSurfs( const string &filename );
     virtual void ReadSurfs( const string &filename );
+    virtual void FetchSurfs();
+    virtual void AddLoadedSurf( Surf* surfPtr );
+    virtual void MergeLoadedSurfs();
 
     virtual void WriteSTL( const string &filename );
     virtual void WriteTetGen( const string &filename );
@@ -253,6 +267,8 @@ public:
     virtual void RemeshSingleComp( int comp_id, int output_type );
 
     virtual void Intersect();
+    virtual void IntersectSurfPairs();
+    virtual void FindCandidateSurfPairs( vector< pair< int, int > > & pair_vec );
     virtual void InitMesh();
 
     virtual void PrintQual();
@@ -265,6 +281,7 @@ public:
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
     virtual void AddIntersectionSeg( SurfPatch& pA, SurfPatch& pB, vec3d & ip0, vec3d & ip1 );
+    virtual void AddIntersectionSeg( const IntersectSeg & seg );
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
@@ -292,8 +309,10 @@ public:
     virtual void BuildMesh();
     virtual void BuildTargetMap( int output_type );
     virtual void RemoveInteriorTris();
+    virtual bool TriInteriorRayTest( int s, Tri* tri, double x_dist );
+    virtual void VoteRegionInteriorTris( int s, vector< Tri* > & region, double x_dist );
     virtual void ConnectBorderEdges( bool wakeOnly );
-    virtual void MatchBorderEdges( list< Edge* > edgeList );
+    virtual void MatchBorderEdges( list< Edge* > & edgeList );
 
     virtual void DebugWriteChains( const char* name, bool tessFlag );
 
@@ -349,6 +368,11 @@ public:
 
     ostringstream m_OutStream;
 
+    std::thread::id m_OutputThreadID;
+    int m_OutputType;
+    std::mutex m_OutputMutex;
+    vector< string > m_PendingOutput;
+
 
     CfdMeshSettings* GetCfdSettingsPtr()
     {
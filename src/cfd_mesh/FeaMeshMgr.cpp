@@ -13,6 +13,7 @@
 #include "Geom.h"
 #include "Vehicle.h"
 #include "Util.h"
+#include "ThreadUtil.h"
 
 
 //=============================================================//
@@ -718,6 +719,8 @@ void FeaMeshMgrSingleton::Build()
         return;
     }
 
+    BeginOutput( FEA_OUTPUT );
+
     BuildClean();
 
     if ( !m_BatchFlag )
@@ -827,11 +830,8 @@ void FeaMeshMgrSingleton::Export()
 
 void FeaMeshMgrSingleton::Intersect()
 {
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
-        for ( int j = i + 1 ; j < ( int )m_SurfVec.size() ; j++ )
-        {
-            m_SurfVec[i]->Intersect( m_SurfVec[j] );
-        }
+    //==== Skin/Slice Pairs Intersect Concurrently - Segments Merged In Pair Order ====//
+    IntersectSurfPairs();
 
     BuildChains();
 //DebugWriteChains("Intersect_UW", false );
@@ -1486,54 +1486,57 @@ void FeaMeshMgrSingleton::LoadCapChains( Surf* s0, double u, list< ISegChain* >
 void FeaMeshMgrSingleton::BuildSliceMesh()
 {
     int i;
+    int nslice = ( int )m_SliceVec.size();
+    int nskin = ( int )m_SkinVec.size();
 
-    //==== Find Upper/Lower Points ====//
-    for ( i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    //==== Find Upper/Lower Points - Slices Only Read Shared Chains ====//
+    ThreadUtil::ParallelFor( nslice, [&]( int s, int thread_index )
     {
-        m_SliceVec[i]->FindUpperLowerPoints();
-    }
+        m_SliceVec[s]->FindUpperLowerPoints();
+    } );
 
     //==== Find Max Number of Divisions ====//
+    GetGridDensityPtr()->UpdateSourceIndex();
+    vector< int > num_div_vec( nslice, 0 );
+    ThreadUtil::ParallelFor( nslice, [&]( int s, int thread_index )
+    {
+        num_div_vec[s] = m_SliceVec[s]->ComputeNumDivisions();
+    } );
+
     int max_num_divisions = 1;
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    for (  i = 0 ; i < nslice ; i++ )
     {
-        int num = m_SliceVec[i]->ComputeNumDivisions();
-        if ( num > max_num_divisions )
+        if ( num_div_vec[i] > max_num_divisions )
         {
-            max_num_divisions = num;
+            max_num_divisions = num_div_vec[i];
         }
     }
     //==== Set Num Divisions For All Slices (So Elements Line Up ) ====//
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    for (  i = 0 ; i < nslice ; i++ )
     {
         m_SliceVec[i]->SetNumDivisions( max_num_divisions );
     }
 
-    //==== Build Skin FEA Elements ====//
-    for (  i = 0 ; i < ( int )m_SkinVec.size() ; i++ )
+    //==== Build Skin FEA Elements - Each Skin Owns Its Elements ====//
+    ThreadUtil::ParallelFor( nskin, [&]( int s, int thread_index )
     {
-        m_SkinVec[i]->BuildMesh();
-        m_SkinVec[i]->SetNodeThick();
-    }
+        m_SkinVec[s]->BuildMesh();
+        m_SkinVec[s]->SetNodeThick();
+    } );
 
     //==== Snap Slice Points to Skin Nodes ====//
     vector < FeaNode* > skinNodes;
-    for (  i = 0 ; i < ( int )m_SkinVec.size() ; i++ )
+    for (  i = 0 ; i < nskin ; i++ )
     {
         m_SkinVec[i]->LoadNodes( skinNodes );
     }
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
-    {
-        m_SliceVec[i]->SnapUpperLowerToSkin( skinNodes );
-    }
 
     //==== Build Slice FEA Elements ====//
-    for (  i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    ThreadUtil::ParallelFor( nslice, [&]( int s, int thread_index )
     {
-        m_SliceVec[i]->BuildMesh();
-    }
-
-
+        m_SliceVec[s]->SnapUpperLowerToSkin( skinNodes );
+        m_SliceVec[s]->BuildMesh();
+    } );
 }
 
 void FeaMeshMgrSingleton::LoadAttachPoints()
@@ -1606,20 +1609,85 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
     }
 }
 
-FeaNode* FeaMeshMgrSingleton::FindNode(  vector< FeaNode* > nodeVec, int id )
+//==== Merge Coincident Nodes And Number Them ====//
+void FeaNodeTable::Build( vector< FeaNode* > & node_vec )
 {
-    //==== jrg Brute Force for Now ====//
-    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+    m_NodeVec = node_vec;
+
+    m_PntVec.resize( m_NodeVec.size() );
+    for ( int i = 0 ; i < ( int )m_NodeVec.size() ; i++ )
     {
-        if ( nodeVec[i]->m_Index == id )
+        m_PntVec[i] = &m_NodeVec[i]->m_Pnt;
+    }
+
+    m_IndMap.clear();
+    m_NumPnts = CfdMeshMgr.BuildIndMap( m_PntVec, m_IndMap, m_PntShift );
+
+    //==== Assign Index Numbers to Nodes ====//
+    m_UniqueNodeVec.clear();
+    m_UniqueNodeVec.reserve( m_NumPnts );
+    for ( int i = 0 ; i < ( int )m_NodeVec.size() ; i++ )
+    {
+        m_NodeVec[i]->m_Tags.clear();
+        int ind = FindPntIndex( m_NodeVec[i]->m_Pnt );
+        m_NodeVec[i]->m_Index = m_PntShift[ind] + 1;
+
+        if ( m_PntShift[i] >= 0 )
         {
-            return nodeVec[i];
+            m_UniqueNodeVec.push_back( m_NodeVec[i] );
         }
     }
+}
 
-    return NULL;
+int FeaNodeTable::FindPntIndex( vec3d & pnt )
+{
+    return CfdMeshMgr.FindPntIndex( pnt, m_PntVec, m_IndMap );
+}
+
+FeaNode* FeaNodeTable::FindNode( vec3d & pnt )
+{
+    if ( m_NodeVec.empty() )
+    {
+        return NULL;
+    }
+    return m_NodeVec[ FindPntIndex( pnt ) ];
 }
 
+//==== Add Node To Bucket Of Tag ID ====//
+static void AddToTagBucket( vector< vector< FeaNode* > > & bucket_vec, int id, FeaNode* node )
+{
+    if ( id < 0 )
+    {
+        return;
+    }
+    if ( id >= ( int )bucket_vec.size() )
+    {
+        bucket_vec.resize( id + 1 );
+    }
+    bucket_vec[id].push_back( node );
+}
+
+//==== Nodes In Bucket Of Tag ID - Empty When None ====//
+static const vector< FeaNode* > & GetTagBucket( const vector< vector< FeaNode* > > & bucket_vec, int id )
+{
+    static const vector< FeaNode* > empty_vec;
+    if ( id < 0 || id >= ( int )bucket_vec.size() )
+    {
+        return empty_vec;
+    }
+    return bucket_vec[id];
+}
+
+//==== Open Deck File - Large Buffer So Records Stream Out In Big Writes ====//
+static FILE* OpenDeckFile( const string & filename )
+{
+    FILE* fp = fopen( filename.c_str(), "w" );
+    if ( fp )
+    {
+        setvbuf( fp, NULL, _IOFBF, 1 << 20 );
+    }
+    return fp;
+}
 
 void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
 {
@@ -1637,29 +1705,15 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         m_SliceVec[i]->LoadNodes( nodeVec );
     }
 
-    vector< vec3d* > allPntVec;
-    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
-    {
-        allPntVec.push_back( &nodeVec[i]->m_Pnt );
-    }
-
-    //==== Build Node Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    int numPnts = CfdMeshMgr.BuildIndMap( allPntVec, indMap, pntShift );
-
-    //==== Assign Index Numbers to Nodes ====//
-    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
-    {
-        nodeVec[i]->m_Tags.clear();
-        int ind = CfdMeshMgr.FindPntIndex( nodeVec[i]->m_Pnt, allPntVec, indMap );
-        nodeVec[i]->m_Index = pntShift[ind] + 1;
-    }
+    //==== Build Node Table - Merged Nodes And Index Numbers ====//
+    FeaNodeTable node_table;
+    node_table.Build( nodeVec );
+    int numPnts = node_table.GetNumPnts();
 
     //Stringc fn( base_filename );
     //fn.concatenate( "NASTRAN.dat" );
 
-    FILE* fp = fopen( filename.c_str(), "w" );
+    FILE* fp = OpenDeckFile( filename );
     if ( fp )
     {
         //===== Write Ribs ====//
@@ -1682,8 +1736,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 //==== Tag Rib Upper/Lower Nodes ====//
                 for ( int i = 0 ; i < ( int )rib->m_UpperPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( rib->m_UpperPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = node_table.FindNode( rib->m_UpperPnts[i] );
                     if ( node )
                     {
                         node->AddTag( RIB_UPPER, rib_cnt );
@@ -1691,8 +1744,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 }
                 for ( int i = 0 ; i < ( int )rib->m_LowerPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( rib->m_LowerPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = node_table.FindNode( rib->m_LowerPnts[i] );
                     if ( node )
                     {
                         node->AddTag( RIB_LOWER, rib_cnt );
@@ -1719,8 +1771,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 //==== Tag Spar Upper/Lower Nodes ====//
                 for ( int i = 0 ; i < ( int )spar->m_UpperPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( spar->m_UpperPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = node_table.FindNode( spar->m_UpperPnts[i] );
                     if ( node )
                     {
                         node->AddTag( SPAR_UPPER, spar_cnt );
@@ -1728,8 +1779,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 }
                 for ( int i = 0 ; i < ( int )spar->m_LowerPnts.size() ; i++ )
                 {
-                    int ind = CfdMeshMgr.FindPntIndex( spar->m_LowerPnts[i], allPntVec, indMap );
-                    FeaNode* node = FindNode( nodeVec, pntShift[ind] + 1 );
+                    FeaNode* node = node_table.FindNode( spar->m_LowerPnts[i] );
                     if ( node )
                     {
                         node->AddTag( SPAR_LOWER, spar_cnt );
@@ -1764,27 +1814,71 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         fprintf( fp, "\n" );
         fprintf( fp, "$Gridpoints\n\n" );
 
-        //==== Write Rib Spar Intersections =====//
-        for ( int r = 0 ; r < rib_cnt ; r++ )
+        //==== Sort Tagged Nodes Into Rib/Spar Groups In One Pass ====//
+        vector< vector< FeaNode* > > rib_upper_vec, rib_lower_vec, spar_upper_vec, spar_lower_vec, lete_vec;
+        vector< FeaNode* > upper_inode_vec( ( rib_cnt + 1 ) * ( spar_cnt + 1 ), NULL );
+        vector< FeaNode* > lower_inode_vec( ( rib_cnt + 1 ) * ( spar_cnt + 1 ), NULL );
+        for ( int i = 0 ; i < ( int )node_table.m_UniqueNodeVec.size() ; i++ )
         {
-            for ( int s = 0 ; s < spar_cnt ; s++ )
+            FeaNode* node = node_table.m_UniqueNodeVec[i];
+            const vector< FeaNodeTag > & tags = node->m_Tags;
+
+            if ( tags.size() == 1 )                 // Boundary Nodes
+            {
+                if ( tags[0].m_Type == RIB_UPPER )
+                {
+                    AddToTagBucket( rib_upper_vec, tags[0].m_ID, node );
+                }
+                else if ( tags[0].m_Type == RIB_LOWER )
+                {
+                    AddToTagBucket( rib_lower_vec, tags[0].m_ID, node );
+                }
+                else if ( tags[0].m_Type == SPAR_UPPER )
+                {
+                    AddToTagBucket( spar_upper_vec, tags[0].m_ID, node );
+                }
+                else if ( tags[0].m_Type == SPAR_LOWER )
+                {
+                    AddToTagBucket( spar_lower_vec, tags[0].m_ID, node );
+                }
+            }
+            else if ( tags.size() > 1 )             // Rib Spar Intersections - Last Node Wins
             {
-                FeaNode* upperINode = NULL;
-                FeaNode* lowerINode = NULL;
-                for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+                for ( int a = 0 ; a < ( int )tags.size() ; a++ )
                 {
-                    if ( nodeVec[i]->m_Tags.size() > 1 )
+                    for ( int b = 0 ; b < ( int )tags.size() ; b++ )
                     {
-                        if ( nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && nodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) )
+                        int ra = tags[a].m_ID;
+                        int sb = tags[b].m_ID;
+                        if ( ra < 1 || ra > rib_cnt || sb < 1 || sb > spar_cnt )
                         {
-                            upperINode = nodeVec[i];
+                            continue;
                         }
-                        if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) )
+                        if ( tags[a].m_Type == RIB_UPPER && tags[b].m_Type == SPAR_UPPER )
                         {
-                            lowerINode = nodeVec[i];
+                            upper_inode_vec[ ra * ( spar_cnt + 1 ) + sb ] = node;
+                        }
+                        if ( tags[a].m_Type == RIB_LOWER && tags[b].m_Type == SPAR_LOWER )
+                        {
+                            lower_inode_vec[ ra * ( spar_cnt + 1 ) + sb ] = node;
                         }
                     }
                 }
+
+                if ( tags.size() == 2 && node->HasTag( RIB_UPPER, tags[0].m_ID ) && node->HasTag( RIB_LOWER, tags[0].m_ID ) )
+                {
+                    AddToTagBucket( lete_vec, tags[0].m_ID, node );
+                }
+            }
+        }
+
+        //==== Write Rib Spar Intersections =====//
+        for ( int r = 0 ; r < rib_cnt ; r++ )
+        {
+            for ( int s = 0 ; s < spar_cnt ; s++ )
+            {
+                FeaNode* upperINode = upper_inode_vec[ ( r + 1 ) * ( spar_cnt + 1 ) + s + 1 ];
+                FeaNode* lowerINode = lower_inode_vec[ ( r + 1 ) * ( spar_cnt + 1 ) + s + 1 ];
                 if ( upperINode && lowerINode )
                 {
                     fprintf( fp, "\n" );
@@ -1797,17 +1891,7 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         //==== Write Out Rib LE/TE ====//
         for ( int r = 0 ; r < rib_cnt ; r++ )
         {
-            vector< FeaNode* > letenodes;
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
-            {
-                if ( nodeVec[i]->m_Tags.size() == 2 )
-                {
-                    if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) )
-                    {
-                        letenodes.push_back( nodeVec[i] );
-                    }
-                }
-            }
+            vector< FeaNode* > letenodes = GetTagBucket( lete_vec, r + 1 );
             if ( letenodes.size() == 2 )
             {
                 if ( letenodes[1]->m_Pnt.x() < letenodes[0]->m_Pnt.x() )
@@ -1831,12 +1915,10 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$RibUpperBoundary,%d\n", r + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & bnd_nodes = GetTagBucket( rib_upper_vec, r + 1 );
+            for ( int i = 0 ; i < ( int )bnd_nodes.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( RIB_UPPER, r + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
-                {
-                    nodeVec[i]->WriteNASTRAN( fp );
-                }
+                bnd_nodes[i]->WriteNASTRAN( fp );
             }
         }
         //==== Write Spar Upper Boundary =====//
@@ -1844,12 +1926,10 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$SparUpperBoundary,%d\n", s + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & bnd_nodes = GetTagBucket( spar_upper_vec, s + 1 );
+            for ( int i = 0 ; i < ( int )bnd_nodes.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( SPAR_UPPER, s + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
-                {
-                    nodeVec[i]->WriteNASTRAN( fp );
-                }
+                bnd_nodes[i]->WriteNASTRAN( fp );
             }
         }
         //==== Write Rib Lower Boundary  =====//
@@ -1857,12 +1937,10 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$RibLowerBoundary,%d\n", r + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & bnd_nodes = GetTagBucket( rib_lower_vec, r + 1 );
+            for ( int i = 0 ; i < ( int )bnd_nodes.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( RIB_LOWER, r + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
-                {
-                    nodeVec[i]->WriteNASTRAN( fp );
-                }
+                bnd_nodes[i]->WriteNASTRAN( fp );
             }
         }
         //==== Write Spar Lower Boundary =====//
@@ -1870,12 +1948,10 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "$SparLowerBoundary,%d\n", s + 1 );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & bnd_nodes = GetTagBucket( spar_lower_vec, s + 1 );
+            for ( int i = 0 ; i < ( int )bnd_nodes.size() ; i++ )
             {
-                if ( nodeVec[i]->HasTag( SPAR_LOWER, s + 1 ) && nodeVec[i]->m_Tags.size() == 1 )
-                {
-                    nodeVec[i]->WriteNASTRAN( fp );
-                }
+                bnd_nodes[i]->WriteNASTRAN( fp );
             }
         }
         //==== Write Point Masses =====//
@@ -1906,18 +1982,18 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
             node.WriteNASTRAN( fp );
 
             //==== Find Attach Point Index ====//
-            int ind = CfdMeshMgr.FindPntIndex( m_PointMassVec[p]->m_AttachPos, allPntVec, indMap );
-            fprintf( fp, "$Connects,%d\n", pntShift[ind] + 1 );
+            FeaNode* attach_node = node_table.FindNode( m_PointMassVec[p]->m_AttachPos );
+            fprintf( fp, "$Connects,%d\n", attach_node ? attach_node->m_Index : 0 );
         }
 
         //==== Remaining Nodes ====//
         fprintf( fp, "\n" );
         fprintf( fp, "$Remainingnodes\n" );
-        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        for ( int i = 0 ; i < ( int )node_table.m_UniqueNodeVec.size() ; i++ )
         {
-            if ( pntShift[i] >= 0 && nodeVec[i]->m_Tags.size() == 0 )
+            if ( node_table.m_UniqueNodeVec[i]->m_Tags.size() == 0 )
             {
-                nodeVec[i]->WriteNASTRAN( fp );
+                node_table.m_UniqueNodeVec[i]->WriteNASTRAN( fp );
             }
         }
 
@@ -1949,24 +2025,10 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         }
     }
 
-    vector< vec3d* > allPntVec;
-    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
-    {
-        allPntVec.push_back( &nodeVec[i]->m_Pnt );
-    }
-
-    //==== Build Node Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    CfdMeshMgr.BuildIndMap( allPntVec, indMap, pntShift );
-
-    //==== Assign Index Numbers to Nodes ====//
-    for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
-    {
-        nodeVec[i]->m_Tags.clear();
-        int ind = CfdMeshMgr.FindPntIndex( nodeVec[i]->m_Pnt, allPntVec, indMap );
-        nodeVec[i]->m_Index = pntShift[ind] + 1;
-    }
+    //==== Build Node Table - Merged Nodes And Index Numbers ====//
+    FeaNodeTable node_table;
+    node_table.Build( nodeVec );
+    vector< FeaNode* > & uniqueNodeVec = node_table.m_UniqueNodeVec;
 
     //==== Tag Nodes ====//
     vector< FeaSkin* > upperSkins;
@@ -1981,8 +2043,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_UpperSkin.LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
-                nodeVec[ind]->AddTag( SKIN_UPPER, s );
+                node_table.FindNode( nVec[i]->m_Pnt )->AddTag( SKIN_UPPER, s );
             }
             upperSkins.push_back( &m_WingSections[s].m_UpperSkin );
         }
@@ -1992,8 +2053,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_LowerSkin.LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
-                nodeVec[ind]->AddTag( SKIN_LOWER, s );
+                node_table.FindNode( nVec[i]->m_Pnt )->AddTag( SKIN_LOWER, s );
             }
             lowerSkins.push_back( &m_WingSections[s].m_LowerSkin );
         }
@@ -2005,8 +2065,7 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_RibVec[r]->LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
-                nodeVec[ind]->AddTag( RIB_ALL, r );
+                node_table.FindNode( nVec[i]->m_Pnt )->AddTag( RIB_ALL, r );
             }
             ribs.push_back( m_WingSections[s].m_RibVec[r] );
         }
@@ -2017,26 +2076,45 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             m_WingSections[s].m_SparVec[r]->LoadNodes( nVec );
             for ( int i = 0 ; i < ( int )nVec.size() ; i++ )
             {
-                int ind = CfdMeshMgr.FindPntIndex( nVec[i]->m_Pnt, allPntVec, indMap );
-                nodeVec[ind]->AddTag( SPAR_ALL, r );
+                node_table.FindNode( nVec[i]->m_Pnt )->AddTag( SPAR_ALL, r );
             }
             spars.push_back( m_WingSections[s].m_SparVec[r] );
         }
     }
 
-//for ( int i = 0 ; i < (int)nodeVec.size() ; i++ )
-//{
-//  if ( nodeVec[i]->HasTag( SPAR_ALL ) &&  nodeVec[i]->HasTag( SKIN_UPPER ) )
-//  {
-//      debugPnts.push_back( nodeVec[i]->m_Pnt );
-//  }
-//}
+    //==== Sort Tagged Nodes Into Rib/Spar Groups In One Pass ====//
+    vector< vector< FeaNode* > > rib_node_vec, spar_node_vec;
+    map< pair< int, int >, vector< FeaNode* > > rib_spar_node_map;
+    for ( int i = 0 ; i < ( int )uniqueNodeVec.size() ; i++ )
+    {
+        FeaNode* node = uniqueNodeVec[i];
+        const vector< FeaNodeTag > & tags = node->m_Tags;
+        for ( int a = 0 ; a < ( int )tags.size() ; a++ )
+        {
+            if ( tags[a].m_Type == RIB_ALL )
+            {
+                AddToTagBucket( rib_node_vec, tags[a].m_ID, node );
+                for ( int b = 0 ; b < ( int )tags.size() ; b++ )
+                {
+                    if ( tags[b].m_Type == SPAR_ALL )
+                    {
+                        rib_spar_node_map[ make_pair( tags[a].m_ID, tags[b].m_ID ) ].push_back( node );
+                    }
+                }
+            }
+            else if ( tags[a].m_Type == SPAR_ALL )
+            {
+                AddToTagBucket( spar_node_vec, tags[a].m_ID, node );
+            }
+        }
+    }
+    vector< FeaNode* > no_node_vec;
 
     //Stringc fn( base_filename );
     //fn.concatenate( "geom.dat" );
 
     string fn = m_ExportFeaFileNames[GEOM_FILE_NAME];
-    FILE* fp = fopen( fn.c_str(), "w" );
+    FILE* fp = OpenDeckFile( fn );
     if ( fp )
     {
         int elem_id = 1;
@@ -2044,19 +2122,16 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         //==== Upper Skin Nodes ====//
         fprintf( fp, "**%%Upper Skin\n" );
         fprintf( fp, "*NODE, NSET=Nupperskin\n" );
-        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        for ( int i = 0 ; i < ( int )uniqueNodeVec.size() ; i++ )
         {
-            if ( pntShift[i] >= 0 )
+            if ( uniqueNodeVec[i]->HasOnlyType( SKIN_UPPER ) )
             {
-                if ( nodeVec[i]->HasOnlyType( SKIN_UPPER ) )
-                {
-                    nodeVec[i]->WriteCalculix( fp );
-                }
-                if ( ( nodeVec[i]->HasTag( SKIN_UPPER ) && nodeVec[i]->HasTag( SKIN_LOWER ) ) &&
-                        ( !nodeVec[i]->HasTag( RIB_ALL )    && !nodeVec[i]->HasTag( SPAR_ALL ) ) )
-                {
-                    nodeVec[i]->WriteCalculix( fp );
-                }
+                uniqueNodeVec[i]->WriteCalculix( fp );
+            }
+            if ( ( uniqueNodeVec[i]->HasTag( SKIN_UPPER ) && uniqueNodeVec[i]->HasTag( SKIN_LOWER ) ) &&
+                    ( !uniqueNodeVec[i]->HasTag( RIB_ALL )    && !uniqueNodeVec[i]->HasTag( SPAR_ALL ) ) )
+            {
+                uniqueNodeVec[i]->WriteCalculix( fp );
             }
         }
         fprintf( fp, "\n" );
@@ -2076,14 +2151,11 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         fprintf( fp, "\n" );
         fprintf( fp, "**%%Lower Skin\n" );
         fprintf( fp, "*NODE, NSET=Nlowerskin\n" );
-        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        for ( int i = 0 ; i < ( int )uniqueNodeVec.size() ; i++ )
         {
-            if ( pntShift[i] >= 0 )
+            if ( uniqueNodeVec[i]->HasOnlyType( SKIN_LOWER ) )
             {
-                if ( nodeVec[i]->HasOnlyType( SKIN_LOWER ) )
-                {
-                    nodeVec[i]->WriteCalculix( fp );
-                }
+                uniqueNodeVec[i]->WriteCalculix( fp );
             }
         }
         fprintf( fp, "\n" );
@@ -2107,15 +2179,13 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             fprintf( fp, "**%%Spar %d\n", s );
             fprintf( fp, "*NODE, NSET=Nspar%d\n", s );
 
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & spar_nodes = GetTagBucket( spar_node_vec, s );
+            for ( int i = 0 ; i < ( int )spar_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 && nodeVec[i]->HasTag( SPAR_ALL, s ) )
+                if ( !spar_nodes[i]->HasTag( RIB_ALL ) )
                 {
-                    if ( !nodeVec[i]->HasTag( RIB_ALL ) )
-                    {
-                        nodeVec[i]->m_Thick = spars[s]->m_Thick();
-                        nodeVec[i]->WriteCalculix( fp );
-                    }
+                    spar_nodes[i]->m_Thick = spars[s]->m_Thick();
+                    spar_nodes[i]->WriteCalculix( fp );
                 }
             }
 
@@ -2147,15 +2217,13 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             fprintf( fp, "**%%Rib %d\n", r );
             fprintf( fp, "*NODE, NSET=Nrib%d\n", r );
 
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & rib_nodes = GetTagBucket( rib_node_vec, r );
+            for ( int i = 0 ; i < ( int )rib_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 && nodeVec[i]->HasTag( RIB_ALL, r ) )
+                if ( !rib_nodes[i]->HasTag( SPAR_ALL ) )
                 {
-                    if ( !nodeVec[i]->HasTag( SPAR_ALL ) )
-                    {
-                        nodeVec[i]->m_Thick = ribs[r]->m_Thick();
-                        nodeVec[i]->WriteCalculix( fp );
-                    }
+                    rib_nodes[i]->m_Thick = ribs[r]->m_Thick();
+                    rib_nodes[i]->WriteCalculix( fp );
                 }
             }
 
@@ -2189,16 +2257,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
                 fprintf( fp, "\n" );
                 fprintf( fp, "**%%Rib-Spar connections %d %d\n", r, s );
                 fprintf( fp, "*NODE, NSET=Nconnections%d%d\n", r, s );
-                for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+                map< pair< int, int >, vector< FeaNode* > >::iterator iter = rib_spar_node_map.find( make_pair( r, s ) );
+                const vector< FeaNode* > & conn_nodes = ( iter != rib_spar_node_map.end() ) ? iter->second : no_node_vec;
+                for ( int i = 0 ; i < ( int )conn_nodes.size() ; i++ )
                 {
-                    if ( pntShift[i] >= 0 )
-                    {
-                        if ( nodeVec[i]->HasTag( RIB_ALL, r ) && nodeVec[i]->HasTag( SPAR_ALL, s ) )
-                        {
-                            nodeVec[i]->m_Thick = 0.5 * ( ribs[r]->m_Thick() + spars[s]->m_Thick() );
-                            nodeVec[i]->WriteCalculix( fp );
-                        }
-                    }
+                    conn_nodes[i]->m_Thick = 0.5 * ( ribs[r]->m_Thick() + spars[s]->m_Thick() );
+                    conn_nodes[i]->WriteCalculix( fp );
                 }
             }
         }
@@ -2210,39 +2274,34 @@ void FeaMeshMgrSingleton::WriteCalculix( )
     //node_fn.concatenate( "nodethick.dat" );
 
     string node_fn = m_ExportFeaFileNames[THICK_FILE_NAME];
-    fp = fopen( node_fn.c_str(), "w" );
+    fp = OpenDeckFile( node_fn );
     if ( fp )
     {
         fprintf( fp, "*NODAL THICKNESS\n" );
 
         //==== Upper Skin Nodes ====//
         fprintf( fp, "**%%Upper Skin\n" );
-        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        for ( int i = 0 ; i < ( int )uniqueNodeVec.size() ; i++ )
         {
-            if ( pntShift[i] >= 0 )
+            FeaNode* node = uniqueNodeVec[i];
+            if ( node->m_Tags.size() == 1 && node->HasTag( SKIN_UPPER ) )
             {
-                if ( nodeVec[i]->m_Tags.size() == 1 && nodeVec[i]->HasTag( SKIN_UPPER ) )
-                {
-                    fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                }
-                if ( nodeVec[i]->m_Tags.size() == 2 &&
-                        nodeVec[i]->HasTag( SKIN_UPPER ) && nodeVec[i]->HasTag( SKIN_LOWER  ) )
-                {
-                    fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                }
-
+                fprintf( fp, "%d,%f\n", node->m_Index, node->m_Thick * m_ThickScale() );
+            }
+            if ( node->m_Tags.size() == 2 &&
+                    node->HasTag( SKIN_UPPER ) && node->HasTag( SKIN_LOWER  ) )
+            {
+                fprintf( fp, "%d,%f\n", node->m_Index, node->m_Thick * m_ThickScale() );
             }
         }
 
         fprintf( fp, "**%%Lower Skin\n" );
-        for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+        for ( int i = 0 ; i < ( int )uniqueNodeVec.size() ; i++ )
         {
-            if ( pntShift[i] >= 0 )
+            FeaNode* node = uniqueNodeVec[i];
+            if ( node->m_Tags.size() == 1 && node->HasTag( SKIN_LOWER ) )
             {
-                if ( nodeVec[i]->m_Tags.size() == 1 && nodeVec[i]->HasTag( SKIN_LOWER ) )
-                {
-                    fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                }
+                fprintf( fp, "%d,%f\n", node->m_Index, node->m_Thick * m_ThickScale() );
             }
         }
 
@@ -2251,14 +2310,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "**%%Spar %d\n", s );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & spar_nodes = GetTagBucket( spar_node_vec, s );
+            for ( int i = 0 ; i < ( int )spar_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 && nodeVec[i]->HasTag( SPAR_ALL, s ) )
+                if ( spar_nodes[i]->m_Tags.size() == 1 )
                 {
-                    if ( nodeVec[i]->m_Tags.size() == 1 )
-                    {
-                        fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                    }
+                    fprintf( fp, "%d,%f\n", spar_nodes[i]->m_Index, spar_nodes[i]->m_Thick * m_ThickScale() );
                 }
             }
         }
@@ -2268,14 +2325,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "**%%Rib %d\n", r );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & rib_nodes = GetTagBucket( rib_node_vec, r );
+            for ( int i = 0 ; i < ( int )rib_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 && nodeVec[i]->HasTag( RIB_ALL, r ) )
+                if ( rib_nodes[i]->m_Tags.size() == 1 )
                 {
-                    if ( nodeVec[i]->m_Tags.size() == 1 )
-                    {
-                        fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                    }
+                    fprintf( fp, "%d,%f\n", rib_nodes[i]->m_Index, rib_nodes[i]->m_Thick * m_ThickScale() );
                 }
             }
         }
@@ -2288,14 +2343,13 @@ void FeaMeshMgrSingleton::WriteCalculix( )
             {
                 fprintf( fp, "\n" );
                 fprintf( fp, "**%%Rib-Spar connections %d %d\n", r, s );
-                for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+                map< pair< int, int >, vector< FeaNode* > >::iterator iter = rib_spar_node_map.find( make_pair( r, s ) );
+                const vector< FeaNode* > & conn_nodes = ( iter != rib_spar_node_map.end() ) ? iter->second : no_node_vec;
+                for ( int i = 0 ; i < ( int )conn_nodes.size() ; i++ )
                 {
-                    if ( pntShift[i] >= 0 && nodeVec[i]->m_Tags.size() == 2 )
+                    if ( conn_nodes[i]->m_Tags.size() == 2 )
                     {
-                        if ( nodeVec[i]->HasTag( RIB_ALL, r ) && nodeVec[i]->HasTag( SPAR_ALL, s ) )
-                        {
-                            fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                        }
+                        fprintf( fp, "%d,%f\n", conn_nodes[i]->m_Index, conn_nodes[i]->m_Thick * m_ThickScale() );
                     }
                 }
             }
@@ -2306,14 +2360,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "**%%Spar-Skin connections %d upperskin \n", s );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & spar_nodes = GetTagBucket( spar_node_vec, s );
+            for ( int i = 0 ; i < ( int )spar_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 )
+                if ( spar_nodes[i]->HasTag( SKIN_UPPER ) )
                 {
-                    if ( nodeVec[i]->HasTag( SPAR_ALL, s ) && nodeVec[i]->HasTag( SKIN_UPPER ) )
-                    {
-                        fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                    }
+                    fprintf( fp, "%d,%f\n", spar_nodes[i]->m_Index, spar_nodes[i]->m_Thick * m_ThickScale() );
                 }
             }
         }
@@ -2323,14 +2375,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "**%%Spar-Skin connections %d lowerskin \n", s );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & spar_nodes = GetTagBucket( spar_node_vec, s );
+            for ( int i = 0 ; i < ( int )spar_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 )
+                if ( spar_nodes[i]->HasTag( SKIN_LOWER ) )
                 {
-                    if ( nodeVec[i]->HasTag( SPAR_ALL, s ) && nodeVec[i]->HasTag( SKIN_LOWER ) )
-                    {
-                        fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                    }
+                    fprintf( fp, "%d,%f\n", spar_nodes[i]->m_Index, spar_nodes[i]->m_Thick * m_ThickScale() );
                 }
             }
         }
@@ -2340,14 +2390,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "**%%Rib-Skin connections %d upperskin \n", r );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & rib_nodes = GetTagBucket( rib_node_vec, r );
+            for ( int i = 0 ; i < ( int )rib_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 )
+                if ( rib_nodes[i]->HasTag( SKIN_UPPER ) )
                 {
-                    if ( nodeVec[i]->HasTag( RIB_ALL, r ) && nodeVec[i]->HasTag( SKIN_UPPER ) )
-                    {
-                        fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                    }
+                    fprintf( fp, "%d,%f\n", rib_nodes[i]->m_Index, rib_nodes[i]->m_Thick * m_ThickScale() );
                 }
             }
         }
@@ -2357,14 +2405,12 @@ void FeaMeshMgrSingleton::WriteCalculix( )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "**%%Rib-Skin connections %d lowerskin \n", r );
-            for ( int i = 0 ; i < ( int )nodeVec.size() ; i++ )
+            const vector< FeaNode* > & rib_nodes = GetTagBucket( rib_node_vec, r );
+            for ( int i = 0 ; i < ( int )rib_nodes.size() ; i++ )
             {
-                if ( pntShift[i] >= 0 )
+                if ( rib_nodes[i]->HasTag( SKIN_LOWER ) )
                 {
-                    if ( nodeVec[i]->HasTag( RIB_ALL, r ) && nodeVec[i]->HasTag( SKIN_LOWER ) )
-                    {
-                        fprintf( fp, "%d,%f\n", nodeVec[i]->m_Index, nodeVec[i]->m_Thick * m_ThickScale() );
-                    }
+                    fprintf( fp, "%d,%f\n", rib_nodes[i]->m_Index, rib_nodes[i]->m_Thick * m_ThickScale() );
                 }
             }
         }
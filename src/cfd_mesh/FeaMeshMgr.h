@@ -67,6 +67,32 @@ public:
 
 };
 
+//==== Export Node Table - Coincident Nodes Merged And Numbered Once Per Export ====//
+class FeaNodeTable
+{
+public:
+    FeaNodeTable()                          { m_NumPnts = 0; }
+    virtual ~FeaNodeTable()                 {}
+
+    //==== Clears Node Tags And Sets Each Node's Export Index ====//
+    void Build( vector< FeaNode* > & node_vec );
+
+    int GetNumPnts()                        { return m_NumPnts; }
+    int FindPntIndex( vec3d & pnt );        // Index In Node Vec Of Merged Node At Pnt
+    FeaNode* FindNode( vec3d & pnt );
+
+    //==== Merged Nodes In Node Vec Order - Only These Carry Tags ====//
+    vector< FeaNode* > m_UniqueNodeVec;
+
+protected:
+
+    int m_NumPnts;
+    vector< FeaNode* > m_NodeVec;
+    vector< vec3d* > m_PntVec;
+    map< int, vector< int > > m_IndMap;
+    vector< int > m_PntShift;
+};
+
 //////////////////////////////////////////////////////////////////////
 class FeaMeshMgrSingleton : public CfdMeshMgrSingleton
 {
@@ -168,8 +194,6 @@ public:
     virtual FeaSkin* GetCurrLowerSkin();
     virtual FeaPointMass* GetCurrPointMass();
 
-    virtual FeaNode* FindNode( vector< FeaNode* > nodeVec, int id );
-
     virtual void AddRib();
     virtual void DelCurrRib();
     virtual void AddSpar();
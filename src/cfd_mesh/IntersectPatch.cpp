@@ -94,7 +94,7 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2 )
     }
 }
 
-void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
+void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< IntersectSeg >* seg_buf )
 {
     int MAX_SUB = 3;
     if ( !Compare( *bp1.get_bbox(), *bp2.get_bbox() ) )
@@ -102,9 +102,6 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
         return;
     }
 
-    SurfPatch bps1[4];
-    SurfPatch bps2[4];
-
     //if ( bp1.bnd_box.diag_dist() < 0.1 )
     //  bp1.SetSubDepth( MAX_SUB + 1 );
 
@@ -113,35 +110,23 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
 
     if ( bp1.GetSubDepth() > MAX_SUB && bp2.GetSubDepth() > MAX_SUB )
     {
-        intersect_quads( bp1, bp2 );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, seg_buf );          // Plane - Plane Intersection
     }
     else
     {
         if ( bp1.GetSubDepth() < bp2.GetSubDepth() )
         {
-            bp1.split_patch( bps1[0], bps1[1], bps1[2], bps1[3] );      // Split Patch1 and Keep Subdividing
-            for ( int i = 0 ; i < 4 ; i++ )
+            for ( int i = 0 ; i < 4 ; i++ )                 // Patch1 Subdivision Is Kept For Other Pairs
             {
-                bps1[i].SetSubDepth( bp1.GetSubDepth() + 1 );
+                intersect( *bp1.get_child( i ), bp2, depth, seg_buf );
             }
-
-            intersect( bps1[0], bp2, depth );
-            intersect( bps1[1], bp2, depth );
-            intersect( bps1[2], bp2, depth );
-            intersect( bps1[3], bp2, depth );
         }
         else
         {
-            bp2.split_patch( bps2[0], bps2[1], bps2[2], bps2[3] );      // Split Patch2 and Keep Subdividing
-            for ( int i = 0 ; i < 4 ; i++ )
+            for ( int i = 0 ; i < 4 ; i++ )                 // Patch2 Subdivision Is Kept For Other Pairs
             {
-                bps2[i].SetSubDepth( bp2.GetSubDepth() + 1 );
+                intersect( bp1, *bp2.get_child( i ), depth, seg_buf );
             }
-
-            intersect( bp1, bps2[0], depth );
-            intersect( bp1, bps2[1], depth );
-            intersect( bp1, bps2[2], depth );
-            intersect( bp1, bps2[3], depth );
         }
     }
 }
@@ -457,7 +442,46 @@ void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth )
 ////    }
 ////}
 
-void intersect_quads( SurfPatch& pa, SurfPatch& pb )
+//===== Project Intersection Segment End Points To Both Patches =====//
+bool project_int_seg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, IntersectSeg & seg )
+{
+    double d = dist_squared( ip0, ip1 );
+    if ( d < DBL_EPSILON )
+    {
+        return false;
+    }
+
+    seg.m_SurfA = pa.get_surf_ptr();
+    seg.m_SurfB = pb.get_surf_ptr();
+    seg.m_Pnt[0] = ip0;
+    seg.m_Pnt[1] = ip1;
+
+    pa.find_closest_uw( ip0, seg.m_UWA[0].v );
+    pb.find_closest_uw( ip0, seg.m_UWB[0].v );
+    pa.find_closest_uw( ip1, seg.m_UWA[1].v );
+    pb.find_closest_uw( ip1, seg.m_UWB[1].v );
+
+    return true;
+}
+
+//===== Add Segment To Buffer Or Directly To Mesh Manager =====//
+static void add_int_seg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, vector< IntersectSeg >* seg_buf )
+{
+    if ( seg_buf )
+    {
+        IntersectSeg seg;
+        if ( project_int_seg( pa, pb, ip0, ip1, seg ) )
+        {
+            seg_buf->push_back( seg );
+        }
+    }
+    else
+    {
+        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+    }
+}
+
+void intersect_quads( SurfPatch& pa, SurfPatch& pb, vector< IntersectSeg >* seg_buf )
 {
     int iflag;
     int coplanar;
@@ -476,28 +500,27 @@ void intersect_quads( SurfPatch& pa, SurfPatch& pb )
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_int_seg( pa, pb, ip0, ip1, seg_buf );
     }
 
     //==== Tri A1 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_int_seg( pa, pb, ip0, ip1, seg_buf );
     }
 
     //==== Tri A2 and B1 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        add_int_seg( pa, pb, ip0, ip1, seg_buf );
     }
 
     //==== Tri A2 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        CfdMeshMgr.AddIntersectionSeg( pa, pb, ip0, ip1 );
+        add_int_seg( pa, pb, ip0, ip1, seg_buf );
     }
 }
-
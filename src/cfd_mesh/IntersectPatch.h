@@ -24,12 +24,28 @@
 #include <list>
 using namespace std;
 
+class Surf;
+
+//===== Intersection Segment Projected To Both Surfaces =====//
+class IntersectSeg
+{
+public:
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+    vec3d m_Pnt[2];
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+};
+
 //===== Check If New Intersection Point Is A Duplicate  =====//
 int is_dup_int_pnt( int ni, vec3d int_pnt[2], vec3d& temp_pnt );
 
 //===== Intersect Two Bezier Patches  =====//
 void intersect( SurfPatch& bp1, SurfPatch& bp2 );
-void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth );
-void intersect_quads( SurfPatch& pa, SurfPatch& pb );
+void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< IntersectSeg >* seg_buf = NULL );
+void intersect_quads( SurfPatch& pa, SurfPatch& pb, vector< IntersectSeg >* seg_buf = NULL );
+
+//===== Project Intersection Segment End Points To Both Patches =====//
+bool project_int_seg( SurfPatch& pa, SurfPatch& pb, vec3d & ip0, vec3d & ip1, IntersectSeg & seg );
 
 #endif
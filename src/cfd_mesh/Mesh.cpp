@@ -17,6 +17,10 @@
 
 #define DEBUG_MESH 1
 
+//==== Node Index Grid Cell Size - Larger Than FindNode Tolerance ====//
+const double NODE_INDEX_CELL_SIZE = 0.001;
+const double NODE_MATCH_TOL_SQ = 0.0000001;
+
 bool LongEdgePairLengthCompare( const pair< Edge*, double >& a, const pair< Edge*, double >& b )
 {
     return ( b.second < a.second );
@@ -40,6 +44,8 @@ Mesh::Mesh()
 
     m_Surf = NULL;
     m_GridDensity = NULL;
+
+    m_NodeIndexDirty = false;
 }
 
 Mesh::~Mesh()
@@ -50,31 +56,40 @@ Mesh::~Mesh()
 
 void Mesh::Clear()
 {
-    list< Tri* >::iterator t;
+    DumpGarbage();
+
+    vector< Tri* >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
-        delete ( *t );
+        m_TriPool.Release( *t );
     }
 
     triList.clear();
 
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
-        delete ( *e );
+        m_EdgePool.Release( *e );
     }
 
     edgeList.clear();
 
-    list< Node* >::iterator n;
+    vector< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
-        delete ( *n );
+        m_NodePool.Release( *n );
     }
 
     nodeList.clear();
 
+    //==== Everything Is Released - Drop Storage Blocks In Bulk ====//
+    m_TriPool.Clear();
+    m_EdgePool.Clear();
+    m_NodePool.Clear();
 
+    m_EdgeIndex.clear();
+    m_NodeIndex.clear();
+    m_NodeIndexDirty = false;
 }
 
 void Mesh::LimitTargetEdgeLength( Node* n )
@@ -148,12 +163,16 @@ void Mesh::LimitTargetEdgeLength( Edge* e )
 void Mesh::LimitTargetEdgeLength()
 {
     Node *n;
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     vector< Edge* >::iterator ne;
     double growratio = m_GridDensity->m_GrowRatio();
     double limitlen;
 
-    edgeList.sort( ShortEdgeTargetLengthCompare );
+    stable_sort( edgeList.begin(), edgeList.end(), ShortEdgeTargetLengthCompare );
+    for ( int i = 0 ; i < ( int )edgeList.size() ; i++ )
+    {
+        edgeList[i]->list_ind = i;
+    }
 
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
@@ -192,7 +211,7 @@ void Mesh::Remesh()
     int num_collapse = 1;
 
     //==== Find Target Edge Lengths ====//
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         ( *e )->ComputeLength();
@@ -229,7 +248,7 @@ void Mesh::Remesh()
 
 void Mesh::LoadSimpTris()
 {
-    list< Tri* >::iterator t;
+    vector< Tri* >::iterator t;
     simpTriVec.resize( triList.size() );
     simpPntVec.resize( triList.size() * 3 );
     simpUWPntVec.resize( triList.size() * 3 );
@@ -343,7 +362,7 @@ int Mesh::CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< ve
 int Mesh::Split( int num_iter )
 {
     int num_long_edges = 0;
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( int iter = 0 ; iter < num_iter ; iter++ )
     {
         //===== Split ====//
@@ -380,8 +399,9 @@ int Mesh::Split( int num_iter )
         //}
 
         num_long_edges = longEdges.size();
+
+        DumpGarbage();
     }
-    DumpGarbage();
 
     return num_long_edges;
 
@@ -392,7 +412,7 @@ int Mesh::Collapse( int num_iter )
     int num_short_edges = 0;
     for ( int iter = 0 ; iter < num_iter ; iter++ )
     {
-        list< Edge* >::iterator e;
+        vector< Edge* >::iterator e;
 
         //==== Collapse =====//
         vector < pair < Edge*, double > > shortEdges;
@@ -432,9 +452,9 @@ int Mesh::Collapse( int num_iter )
         //{
         //      ComputeTargetEdgeLength(*e);
         //}
-    }
 
-    DumpGarbage();
+        DumpGarbage();
+    }
 
     return num_short_edges;
 
@@ -443,7 +463,7 @@ int Mesh::Collapse( int num_iter )
 
 void Mesh::ColorTris()
 {
-    list< Tri* >::iterator t;
+    vector< Tri* >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
         double q = ( *t )->ComputeQual();
@@ -469,28 +489,52 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
+    Node* nptr = m_NodePool.Create( p, uw_in );
+    nptr->list_ind = ( int )nodeList.size();
     nodeList.push_back( nptr );
-    nptr->list_ptr = --nodeList.end();
+    IndexNode( nptr );
     return nptr;
 }
 
 void Mesh::RemoveNode( Node* nptr )
 {
+    UnIndexNode( nptr );
+
     garbageNodeVec.push_back( nptr );
-    nodeList.erase( nptr->list_ptr );
+    nodeList[ nptr->list_ind ] = NULL;
 
     nptr->m_DeleteMeFlag = true;
 }
 
 Node* Mesh::FindNode( const vec3d& p )
 {
-    list< Node* >::iterator n;
-    for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
+    if ( m_NodeIndexDirty )
+    {
+        RebuildNodeIndex();
+    }
+
+    //==== Cell Size Exceeds Match Tolerance - Only Check Neighboring Cells ====//
+    int ci, cj, ck;
+    NodeCell( p, ci, cj, ck );
+
+    for ( int i = ci - 1 ; i <= ci + 1 ; i++ )
     {
-        if ( !( *n )->m_DeleteMeFlag && dist_squared( ( *n )->pnt, p ) < 0.0000001 )
+        for ( int j = cj - 1 ; j <= cj + 1 ; j++ )
         {
-            return ( *n );
+            for ( int k = ck - 1 ; k <= ck + 1 ; k++ )
+            {
+                pair< unordered_multimap< long long, Node* >::iterator, unordered_multimap< long long, Node* >::iterator > range;
+                range = m_NodeIndex.equal_range( NodeCellKey( i, j, k ) );
+
+                unordered_multimap< long long, Node* >::iterator n;
+                for ( n = range.first ; n != range.second ; n++ )
+                {
+                    if ( !n->second->m_DeleteMeFlag && dist_squared( n->second->pnt, p ) < NODE_MATCH_TOL_SQ )
+                    {
+                        return n->second;
+                    }
+                }
+            }
         }
     }
     return NULL;
@@ -498,10 +542,11 @@ Node* Mesh::FindNode( const vec3d& p )
 
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = m_EdgePool.Create( n0, n1 );
 
+    eptr->list_ind = ( int )edgeList.size();
     edgeList.push_back( eptr );
-    eptr->list_ptr = --edgeList.end();
+    IndexEdge( eptr );
 
     n0->AddConnectEdge( eptr );
     n1->AddConnectEdge( eptr );
@@ -516,80 +561,216 @@ void Mesh::RemoveEdge( Edge* eptr )
     eptr->n0->RemoveConnectEdge( eptr );
     eptr->n1->RemoveConnectEdge( eptr );
 
+    UnIndexEdge( eptr );
+
     garbageEdgeVec.push_back( eptr );
-    edgeList.erase( eptr->list_ptr );
+    edgeList[ eptr->list_ind ] = NULL;
 
     eptr->m_DeleteMeFlag = true;
 }
 
 Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 {
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    unordered_map< pair< Node*, Node* >, Edge*, NodePairHash >::iterator e = m_EdgeIndex.find( EdgeKey( n0, n1 ) );
+    if ( e != m_EdgeIndex.end() && !e->second->m_DeleteMeFlag )
     {
-        if ( !( *e )->m_DeleteMeFlag )
+        return e->second;
+    }
+    return NULL;
+}
+
+//==== Change Edge End Node and Keep Edge Index Current ====//
+void Mesh::ReplaceEdgeNode( Edge* eptr, Node* curr_node, Node* replace_node )
+{
+    UnIndexEdge( eptr );
+    eptr->ReplaceNode( curr_node, replace_node );
+    IndexEdge( eptr );
+}
+
+//==== Reassign Both Edge End Nodes and Keep Edge Index Current ====//
+void Mesh::SetEdgeNodes( Edge* eptr, Node* n0, Node* n1 )
+{
+    UnIndexEdge( eptr );
+    eptr->n0 = n0;
+    eptr->n1 = n1;
+    IndexEdge( eptr );
+}
+
+pair< Node*, Node* > Mesh::EdgeKey( Node* n0, Node* n1 )
+{
+    if ( n1 < n0 )
+    {
+        return pair< Node*, Node* >( n1, n0 );
+    }
+    return pair< Node*, Node* >( n0, n1 );
+}
+
+long long Mesh::NodeCellKey( int i, int j, int k )
+{
+    //==== Spatial Hash - Collisions Are Resolved By Distance Check ====//
+    return ( ( long long )i * 73856093LL ) ^ ( ( long long )j * 19349663LL ) ^ ( ( long long )k * 83492791LL );
+}
+
+void Mesh::NodeCell( const vec3d& p, int & i, int & j, int & k )
+{
+    i = ( int )floor( p.x() / NODE_INDEX_CELL_SIZE );
+    j = ( int )floor( p.y() / NODE_INDEX_CELL_SIZE );
+    k = ( int )floor( p.z() / NODE_INDEX_CELL_SIZE );
+}
+
+void Mesh::IndexEdge( Edge* eptr )
+{
+    m_EdgeIndex[ EdgeKey( eptr->n0, eptr->n1 ) ] = eptr;
+}
+
+void Mesh::UnIndexEdge( Edge* eptr )
+{
+    unordered_map< pair< Node*, Node* >, Edge*, NodePairHash >::iterator e = m_EdgeIndex.find( EdgeKey( eptr->n0, eptr->n1 ) );
+    if ( e != m_EdgeIndex.end() && e->second == eptr )
+    {
+        m_EdgeIndex.erase( e );
+    }
+}
+
+void Mesh::IndexNode( Node* nptr )
+{
+    if ( m_NodeIndexDirty )
+    {
+        return;                 // Rebuilt From nodeList On Next FindNode
+    }
+
+    int i, j, k;
+    NodeCell( nptr->pnt, i, j, k );
+    m_NodeIndex.insert( pair< long long, Node* >( NodeCellKey( i, j, k ), nptr ) );
+}
+
+void Mesh::UnIndexNode( Node* nptr )
+{
+    if ( m_NodeIndexDirty )
+    {
+        return;                 // Rebuilt From nodeList On Next FindNode
+    }
+
+    int i, j, k;
+    NodeCell( nptr->pnt, i, j, k );
+
+    pair< unordered_multimap< long long, Node* >::iterator, unordered_multimap< long long, Node* >::iterator > range;
+    range = m_NodeIndex.equal_range( NodeCellKey( i, j, k ) );
+
+    unordered_multimap< long long, Node* >::iterator n;
+    for ( n = range.first ; n != range.second ; n++ )
+    {
+        if ( n->second == nptr )
         {
-            if ( ( *e )->n0 == n0 && ( *e )->n1 == n1 )
-            {
-                return ( *e );
-            }
-            if ( ( *e )->n0 == n1 && ( *e )->n1 == n0 )
-            {
-                return ( *e );
-            }
+            m_NodeIndex.erase( n );
+            return;
+        }
+    }
+
+    //==== Node Moved Since It Was Indexed ====//
+    MarkNodeIndexDirty();
+}
+
+void Mesh::MarkNodeIndexDirty()
+{
+    //==== Drop Stale Entries - Nothing Is Indexed Until FindNode Rebuilds ====//
+    m_NodeIndex.clear();
+    m_NodeIndexDirty = true;
+}
+
+void Mesh::RebuildNodeIndex()
+{
+    m_NodeIndex.clear();
+    m_NodeIndexDirty = false;
+
+    vector< Node* >::iterator n;
+    for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
+    {
+        if ( *n )
+        {
+            IndexNode( *n );
         }
     }
-    return NULL;
 }
 
 Tri* Mesh::AddTri( Node* n0, Node* n1, Node* n2, Edge* e0, Edge* e1, Edge* e2 )
 {
-    Tri* tptr = new Tri( n0, n1, n2, e0, e1, e2 );
+    Tri* tptr = m_TriPool.Create( n0, n1, n2, e0, e1, e2 );
+    tptr->list_ind = ( int )triList.size();
     triList.push_back( tptr );
-    tptr->list_ptr = --triList.end();
     return tptr;
 }
 
 void Mesh::RemoveTri( Tri* tptr )
 {
     garbageTriVec.push_back( tptr );
-    triList.erase( tptr->list_ptr );
+    triList[ tptr->list_ind ] = NULL;
     tptr->m_DeleteMeFlag = true;
 }
 
+//==== Close Gaps Left By Removed Entities, Keeping Order ====//
+template < class T >
+static void CompactList( vector< T* > & vec )
+{
+    int num = 0;
+    for ( int i = 0 ; i < ( int )vec.size() ; i++ )
+    {
+        if ( vec[i] )
+        {
+            vec[i]->list_ind = num;
+            vec[num] = vec[i];
+            num++;
+        }
+    }
+    vec.resize( num );
+}
+
 void Mesh::DumpGarbage()
 {
+    if ( garbageNodeVec.size() )
+    {
+        CompactList( nodeList );
+    }
+    if ( garbageEdgeVec.size() )
+    {
+        CompactList( edgeList );
+    }
+    if ( garbageTriVec.size() )
+    {
+        CompactList( triList );
+    }
+
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        m_NodePool.Release( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        m_EdgePool.Release( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Tris =====//
     for ( int i = 0 ; i < ( int )garbageTriVec.size() ; i++ )
     {
-        delete garbageTriVec[i];
+        m_TriPool.Release( garbageTriVec[i] );
     }
     garbageTriVec.clear();
 }
 
 void Mesh::SetNodeFlags()
 {
-    list< Node* >::iterator n;
+    vector< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
     {
         ( *n )->fixed = false;
     }
 
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( ( *e )->border || ( *e )->ridge )
@@ -828,8 +1009,7 @@ void Mesh::SwapEdge( Edge* edge )
     Edge* eb0 = tb->FindEdge( n0, nb );
     Edge* eb1 = tb->FindEdge( nb, n1 );
 
-    edge->n0 = na;
-    edge->n1 = nb;
+    SetEdgeNodes( edge, na, nb );
     edge->ComputeLength();
     ComputeTargetEdgeLength( edge );
 
@@ -1021,15 +1201,9 @@ bool Mesh::ValidNodeMove( Node* nptr, vec3d & move_to, Tri* ignoreTri )
 void Mesh::CollapseHighlightEdge()
 {
     Edge* hedge = NULL;
-    int cnt = 0;
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
+    if ( m_HighlightEdgeIndex >= 0 && m_HighlightEdgeIndex < ( int )edgeList.size() )
     {
-        if ( cnt == m_HighlightEdgeIndex )
-        {
-            hedge = ( *e );
-        }
-        cnt++;
+        hedge = edgeList[ m_HighlightEdgeIndex ];
     }
 
     if ( hedge && ValidCollapse( hedge ) )
@@ -1181,7 +1355,7 @@ void Mesh::CollapseEdge( Edge* edge )
         Edge* e = n0->edgeVec[i];
         if ( e != edge && e != ea0 && e != ea1 && e != eb0 && e != eb1 )
         {
-            e->ReplaceNode( n0, nc );
+            ReplaceEdgeNode( e, n0, nc );
 //CheckValidEdge(e);
             nc->AddConnectEdge( e );
             CheckValidEdge( e );
@@ -1194,7 +1368,7 @@ void Mesh::CollapseEdge( Edge* edge )
         Edge* e = n1->edgeVec[i];
         if ( e != edge && e != ea0 && e != ea1 && e != eb0 && e != eb1 )
         {
-            e->ReplaceNode( n1, nc );
+            ReplaceEdgeNode( e, n1, nc );
 //CheckValidEdge(e);
             nc->AddConnectEdge( e );
             CheckValidEdge( e );
@@ -1226,9 +1400,11 @@ void Mesh::CollapseEdge( Edge* edge )
 
 void Mesh::LaplacianSmooth( int num_iter )
 {
+    MarkNodeIndexDirty();
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
-        list< Node* >::iterator n;
+        vector< Node* >::iterator n;
         for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
         {
             if ( !( *n )->m_DeleteMeFlag && !( *n )->fixed )
@@ -1248,9 +1424,11 @@ void Mesh::LaplacianSmooth( int num_iter )
 
 void Mesh::OptSmooth( int num_iter )
 {
+    MarkNodeIndexDirty();
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
-        list< Node* >::iterator n;
+        vector< Node* >::iterator n;
         for ( n = nodeList.begin() ; n != nodeList.end(); n++ )
         {
             if ( !( *n )->m_DeleteMeFlag && !( *n )->fixed )
@@ -1266,7 +1444,7 @@ void Mesh::AdjustEdgeLengths()
 {
     //==== Find Avg Edge Length ====//
     double avg_length = 0.0;
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         avg_length += dist( ( *e )->n0->pnt, ( *e )->n1->pnt );
@@ -1274,6 +1452,8 @@ void Mesh::AdjustEdgeLengths()
 
     avg_length /= ( double )edgeList.size();
 
+    MarkNodeIndexDirty();
+
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( !( *e )->n0->fixed && !( *e )->n1->fixed )
@@ -1318,7 +1498,7 @@ void Mesh::ComputeTargetEdgeLength( Edge* edge )
 
 void Mesh::CheckValidAllEdges()
 {
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( !( *e )->m_DeleteMeFlag )
@@ -1668,7 +1848,7 @@ void Mesh::InitMesh( vector< vec2d > & uw_points, vector< MeshSeg > & segs_index
     }
 
     //==== Fix The Exterior Edges ====//
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( ( *e )->t0 == NULL || ( *e )->t1 == NULL )
@@ -1737,7 +1917,7 @@ void Mesh::RemoveInteriorTrisEdgesNodes()
     set < Edge* > remEdges;
     set < Node* > remNodes;
 
-    list< Tri* >::iterator t;
+    vector< Tri* >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); t++ )
     {
         //==== Check Surrounding Tris =====//
@@ -1809,6 +1989,55 @@ void Mesh::RemoveInteriorTrisEdgesNodes()
 }
 
 
+//==== Group Tris Connected Without Crossing Border Edges ====//
+void Mesh::BuildTriRegions( vector< vector< Tri* > > & region_vec )
+{
+    region_vec.clear();
+
+    vector< Tri* >::iterator t;
+    for ( t = triList.begin() ; t != triList.end(); t++ )
+    {
+        ( *t )->regionID = -1;
+    }
+
+    vector< Tri* > stack;
+    for ( t = triList.begin() ; t != triList.end(); t++ )
+    {
+        if ( ( *t )->regionID >= 0 )
+        {
+            continue;
+        }
+
+        int rid = ( int )region_vec.size();
+        region_vec.push_back( vector< Tri* >() );
+        vector< Tri* > & region = region_vec.back();
+
+        ( *t )->regionID = rid;
+        stack.push_back( *t );
+
+        while ( !stack.empty() )
+        {
+            Tri* tri = stack.back();
+            stack.pop_back();
+            region.push_back( tri );
+
+            Edge* edges[3] = { tri->e0, tri->e1, tri->e2 };
+            for ( int i = 0 ; i < 3 ; i++ )
+            {
+                if ( !edges[i]->border )
+                {
+                    Tri* adj = edges[i]->OtherTri( tri );
+                    if ( adj && adj->regionID < 0 )
+                    {
+                        adj->regionID = rid;
+                        stack.push_back( adj );
+                    }
+                }
+            }
+        }
+    }
+}
+
 void Mesh::ReadSTL( const char* file_name )
 {
     FILE* file_id = fopen( file_name, "r" );
@@ -1936,7 +2165,7 @@ void Mesh::ReadSTL( const char* file_name )
     fclose( file_id );
 
     //==== Fix The Exterior Edges ====//
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         if ( ( *e )->t0 == NULL || ( *e )->t1 == NULL )
@@ -2016,7 +2245,7 @@ void Mesh::Draw()
 
     Edge* hl_edge = NULL;
     int edge_cnt = 0;
-    list< Edge* >::iterator e;
+    vector< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); e++ )
     {
         glLineWidth( 1.0 );
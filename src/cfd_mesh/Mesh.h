@@ -11,9 +11,12 @@
 #if !defined(MESH_MESH__INCLUDED_)
 #define MESH_MESH__INCLUDED_
 
+#include "UsingCpp11.h"
+
 #include "Vec2d.h"
 #include "Vec3d.h"
 #include "Tri.h"
+#include "MeshPool.h"
 
 class Surf;
 class GridDensity;
@@ -28,6 +31,7 @@ class GridDensity;
 
 #include <vector>
 #include <list>
+#include <unordered_map>
 using namespace std;
 
 extern "C"
@@ -42,6 +46,17 @@ public:
     int m_Index[2];
 };
 
+//==== Hash For Node Pair Keys Used By The Edge Index ====//
+struct NodePairHash
+{
+    size_t operator()( const pair< Node*, Node* > & np ) const
+    {
+        size_t h0 = hash< Node* >()( np.first );
+        size_t h1 = hash< Node* >()( np.second );
+        return h0 ^ ( h1 + 0x9e3779b9 + ( h0 << 6 ) + ( h0 >> 2 ) );
+    }
+};
+
 //////////////////////////////////////////////////////////////////////
 class Mesh
 {
@@ -101,6 +116,9 @@ public:
     void  RemoveEdge( Edge* eptr );
     Edge* FindEdge( Node* n0, Node* n1 );
 
+    void ReplaceEdgeNode( Edge* eptr, Node* curr_node, Node* replace_node );
+    void SetEdgeNodes( Edge* eptr, Node* n0, Node* n1 );
+
     Tri* AddTri( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 );
     void  RemoveTri( Tri* tptr );
 
@@ -137,7 +155,8 @@ public:
 
     void ColorTris();
 
-    list <Tri*> GetTriList()
+    //==== Read-Only View - Copy Explicitly If The Mesh Will Change While Iterating ====//
+    const vector< Tri* > & GetTriList() const
     {
         return triList;
     }
@@ -158,6 +177,7 @@ public:
     void StretchSimpPnts( double start_x, double end_x, double factor, double angle );
 
     void RemoveInteriorTrisEdgesNodes();
+    void BuildTriRegions( vector< vector< Tri* > > & region_vec );
 
     int m_Iteration;
 
@@ -166,18 +186,40 @@ protected:
     Surf* m_Surf;
     GridDensity* m_GridDensity;
 
-    list < Tri* > triList;
-    list < Edge* > edgeList;
-    list < Node* > nodeList;
+    //==== Live Entities In Creation Order - Removal Leaves A NULL Slot Until DumpGarbage ====//
+    vector < Tri* > triList;
+    vector < Edge* > edgeList;
+    vector < Node* > nodeList;
 
     vector< Tri* > garbageTriVec;
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    //==== Entity Storage - Garbage Is Returned Here By DumpGarbage ====//
+    MeshPool< Tri > m_TriPool;
+    MeshPool< Edge > m_EdgePool;
+    MeshPool< Node > m_NodePool;
+
     int m_TotalIterations;
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
+    //==== Edge And Node Lookup Indices ====//
+    static pair< Node*, Node* > EdgeKey( Node* n0, Node* n1 );
+    static long long NodeCellKey( int i, int j, int k );
+    static void NodeCell( const vec3d& p, int & i, int & j, int & k );
+
+    void IndexEdge( Edge* eptr );
+    void UnIndexEdge( Edge* eptr );
+    void IndexNode( Node* nptr );
+    void UnIndexNode( Node* nptr );
+    void MarkNodeIndexDirty();
+    void RebuildNodeIndex();
+
+    unordered_map< pair< Node*, Node* >, Edge*, NodePairHash > m_EdgeIndex;     // Node Pair->Edge
+    unordered_multimap< long long, Node* > m_NodeIndex;                          // Grid Cell->Node
+    bool m_NodeIndexDirty;                                                       // Nodes Moved Since Indexed
+
     vector< vec3d > simpPntVec;
     vector< vec2d > simpUWPntVec;
     vector< SimpTri > simpTriVec;
@@ -0,0 +1,106 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// MeshPool.h
+// Block storage for mesh entities (Node, Edge, Tri)
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(MESH_MESHPOOL__INCLUDED_)
+#define MESH_MESHPOOL__INCLUDED_
+
+#include <assert.h>
+
+#include <new>
+#include <utility>
+#include <vector>
+using namespace std;
+
+//////////////////////////////////////////////////////////////////////
+// Objects are constructed in place inside large contiguous blocks, so
+// pointers stay valid until released.  Released slots go on a free list
+// and are reused first (most recently freed first).  Clear() drops all
+// blocks at once; every live object must have been released before.
+//////////////////////////////////////////////////////////////////////
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool( int block_size = 4096 )
+    {
+        m_BlockSize = block_size;
+        m_NumUsedInBlock = block_size;
+        m_NumLive = 0;
+    }
+    virtual ~MeshPool()
+    {
+        Clear();
+    }
+
+    template < class... Args >
+    T* Create( Args&&... args )
+    {
+        void* slot;
+        if ( m_FreeVec.size() )
+        {
+            slot = m_FreeVec.back();
+            m_FreeVec.pop_back();
+        }
+        else
+        {
+            if ( m_NumUsedInBlock == m_BlockSize )
+            {
+                m_BlockVec.push_back( static_cast< T* >( ::operator new( sizeof( T ) * m_BlockSize ) ) );
+                m_NumUsedInBlock = 0;
+            }
+            slot = m_BlockVec.back() + m_NumUsedInBlock;
+            m_NumUsedInBlock++;
+        }
+        m_NumLive++;
+        return new( slot ) T( std::forward< Args >( args )... );
+    }
+
+    void Release( T* ptr )
+    {
+        assert( m_NumLive > 0 );
+        ptr->~T();
+        m_FreeVec.push_back( ptr );
+        m_NumLive--;
+    }
+
+    void Clear()
+    {
+        assert( m_NumLive == 0 );
+        for ( int i = 0 ; i < ( int )m_BlockVec.size() ; i++ )
+        {
+            ::operator delete( m_BlockVec[i] );
+        }
+        m_BlockVec.clear();
+        vector< T* >().swap( m_FreeVec );
+        m_NumUsedInBlock = m_BlockSize;
+        m_NumLive = 0;
+    }
+
+    int GetNumLive() const
+    {
+        return m_NumLive;
+    }
+
+protected:
+
+    MeshPool( MeshPool const& copy );               // Not Implemented
+    MeshPool& operator=( MeshPool const& copy );    // Not Implemented
+
+    int m_BlockSize;
+    int m_NumUsedInBlock;
+    int m_NumLive;
+
+    vector< T* > m_BlockVec;
+    vector< T* > m_FreeVec;
+
+};
+
+#endif
@@ -16,6 +16,8 @@
 #include "StlHelper.h"
 #include "SubSurface.h"
 #include "SubSurfaceMgr.h"
+#include "VspSurf.h"
+#include "IntersectPatch.h"
 
 Surf::Surf()
 {
@@ -119,6 +121,28 @@ void Surf::ReadSurf( FILE* file_id )
     }
 }
 
+//===== Load Surf Directly From VspSurf Section =====//
+void Surf::LoadBezSection( const BezSection & sect, int vspsurf_ind )
+{
+    m_VspSurfInd = vspsurf_ind;
+
+    u_to_vspsurf = sect.m_UMap;
+    w_to_vspsurf = sect.m_WMap;
+
+    for ( int i = 0 ; i < ( int )u_to_vspsurf.size() ; i++ )
+    {
+        u_to_surf[ u_to_vspsurf[i] ] = i;
+    }
+
+    for ( int i = 0 ; i < ( int )w_to_vspsurf.size() ; i++ )
+    {
+        w_to_surf[ w_to_vspsurf[i] ] = i;
+    }
+
+    vector< vector< vec3d > > pnts = sect.m_Pnts;
+    LoadControlPnts( pnts );
+}
+
 void Surf::LoadControlPnts( vector< vector< vec3d > > & control_pnts )
 {
     int i, j;
@@ -491,7 +515,21 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
-    // Loop over surface evaluating source strength and curvature
+    // Evaluate source strength for all map points in one batch
+    vector< vec3d > map_pnts( nmapu * nmapw );
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        double u = ( 1.0 * i ) / ( m_NumMap - 1 );
+        for( int j = 0; j < nmapw ; j++ )
+        {
+            double w = ( 1.0 * j ) / ( m_NumMap - 1 );
+            map_pnts[ i * nmapw + j ] = CompPnt( u, w );
+        }
+    }
+    vector< double > grid_lens;
+    m_GridDensityPtr->GetTargetLen( map_pnts, grid_lens, limitFlag );
+
+    // Loop over surface evaluating curvature
     for( int i = 0; i < nmapu ; i++ )
     {
         double u = ( 1.0 * i ) / ( m_NumMap - 1 );
@@ -509,9 +547,8 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
             len = max( len, m_GridDensityPtr->m_MinLen() );
 
             // apply sources
-            vec3d p = CompPnt( u, w );
-            double grid_len = m_GridDensityPtr->GetTargetLen( p, limitFlag );
-            len = min( len, grid_len );
+            vec3d& p = map_pnts[ i * nmapw + j ];
+            len = min( len, grid_lens[ i * nmapw + j ] );
 
             // finally check max size
             len = min( len, m_GridDensityPtr->GetBaseLen( limitFlag ) );
@@ -1220,25 +1257,39 @@ void Surf::WriteSTL( const char* filename )
 
 void Surf::Intersect( Surf* surfPtr )
 {
-    int i;
+    if ( PrepIntersect( surfPtr ) )
+    {
+        IntersectPatches( surfPtr );
+    }
+}
 
+//==== Check If Surfaces Need Patch Intersection - May Add Co-Planar Border Curves ====//
+bool Surf::PrepIntersect( Surf* surfPtr )
+{
     if ( surfPtr->GetCompID() == m_CompID )
     {
-        return;
+        return false;
     }
 
     if ( !Compare( m_BBox, surfPtr->GetBBox() ) )
     {
-        return;
+        return false;
     }
     if ( BorderCurveOnSurface( surfPtr ) )
     {
-        return;
+        return false;
     }
     if ( surfPtr->BorderCurveOnSurface( this ) )
     {
-        return;
+        return false;
     }
+    return true;
+}
+
+//==== Intersect Patch Pairs - Segments Buffered When seg_buf Is Given ====//
+void Surf::IntersectPatches( Surf* surfPtr, vector< IntersectSeg >* seg_buf )
+{
+    int i;
 
     vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
     for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
@@ -1248,9 +1299,14 @@ void Surf::Intersect( Surf* surfPtr )
             {
                 if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
                 {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], 0 );
-                    m_PatchVec[i]->draw_flag = true;
-                    otherPatchVec[j]->draw_flag = true;
+                    intersect( *m_PatchVec[i], *otherPatchVec[j], 0, seg_buf );
+
+                    //==== Patches Are Shared Between Concurrent Pairs - Only Flag When Serial ====//
+                    if ( !seg_buf )
+                    {
+                        m_PatchVec[i]->draw_flag = true;
+                        otherPatchVec[j]->draw_flag = true;
+                    }
                 }
             }
         }
@@ -1285,8 +1341,8 @@ void Surf::IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_va
     }
 
     double tparm, uparm, vparm;
-    list< Tri* >::iterator t;
-    list <Tri*> triList = m_Mesh.GetTriList();
+    vector< Tri* >::const_iterator t;
+    const vector< Tri* > & triList = m_Mesh.GetTriList();
 
     vec3d dir = p1 - p0;
 
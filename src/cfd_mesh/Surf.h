@@ -31,6 +31,8 @@ using namespace std;
 class CfdMeshMgrSingleton;
 class SCurve;
 class ISegChain;
+class BezSection;
+class IntersectSeg;
 
 //////////////////////////////////////////////////////////////////////
 class Surf
@@ -43,6 +45,7 @@ public:
     void BuildClean();
 
     void ReadSurf( FILE* file_id );
+    void LoadBezSection( const BezSection & sect, int vspsurf_ind );
     void LoadControlPnts( vector< vector< vec3d > > & pnts );
 
     //===== Bezier Funcs ====//
@@ -152,6 +155,8 @@ public:
     }
 
     void Intersect( Surf* surfPtr );
+    bool PrepIntersect( Surf* surfPtr );
+    void IntersectPatches( Surf* surfPtr, vector< IntersectSeg >* seg_buf = NULL );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
     void IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
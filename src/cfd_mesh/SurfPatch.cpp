@@ -22,10 +22,96 @@ SurfPatch::SurfPatch()
     m_SurfPtr = NULL;
     sub_depth = 0;
     draw_flag = false;
+    m_Children = NULL;
+    m_PlanarState = -1;
+}
+
+SurfPatch::SurfPatch( const SurfPatch& copy )
+{
+    m_Children = NULL;
+    m_PlanarState = -1;
+    *this = copy;
+}
+
+SurfPatch& SurfPatch::operator=( const SurfPatch& copy )
+{
+    if ( this == &copy )
+    {
+        return *this;
+    }
+
+    clear_children();
+
+    m_SurfPtr = copy.m_SurfPtr;
+    plane_tol = copy.plane_tol;
+    u_min = copy.u_min;
+    u_max = copy.u_max;
+    w_min = copy.w_min;
+    w_max = copy.w_max;
+    for ( int iu = 0 ; iu < 4 ; iu++ )
+    {
+        for ( int iw = 0 ; iw < 4 ; iw++ )
+        {
+            pnts[iu][iw] = copy.pnts[iu][iw];
+        }
+    }
+    bnd_box = copy.bnd_box;
+    sub_depth = copy.sub_depth;
+    draw_flag = copy.draw_flag;
+
+    return *this;
 }
 
 SurfPatch::~SurfPatch()
 {
+    clear_children();
+}
+
+//==== Split On First Use - A Thread Losing The Race Drops Its Split ====//
+SurfPatch* SurfPatch::get_child( int i )
+{
+    SurfPatch* children = m_Children.load( std::memory_order_acquire );
+
+    if ( !children )
+    {
+        SurfPatch* split = new SurfPatch[4];
+        split_patch( split[0], split[1], split[2], split[3] );
+        for ( int c = 0 ; c < 4 ; c++ )
+        {
+            split[c].SetSubDepth( sub_depth + 1 );
+        }
+
+        if ( m_Children.compare_exchange_strong( children, split, std::memory_order_acq_rel ) )
+        {
+            children = split;
+        }
+        else
+        {
+            delete [] split;
+        }
+    }
+
+    return &children[i];
+}
+
+//==== Planar Test Result Is Kept With The Node ====//
+bool SurfPatch::is_planar()
+{
+    int state = m_PlanarState.load( std::memory_order_relaxed );
+    if ( state < 0 )
+    {
+        state = test_planar( DEFAULT_PLANE_TOL ) ? 1 : 0;
+        m_PlanarState.store( state, std::memory_order_relaxed );
+    }
+    return ( state == 1 );
+}
+
+//==== Drop Subdivision - Not Safe While Other Threads Walk It ====//
+void SurfPatch::clear_children()
+{
+    SurfPatch* children = m_Children.exchange( NULL );
+    delete [] children;
+    m_PlanarState = -1;
 }
 
 //===== Compute Blending Functions  =====//
@@ -452,7 +538,7 @@ void SurfPatch::IntersectLineSeg( vec3d & p0, vec3d & p1, BndBox & line_box, vec
     }
 
     //==== Do Tri Seg intersection ====//
-    if ( test_planar( DEFAULT_PLANE_TOL ) )
+    if ( is_planar() )
     {
         double r, s, t;
         vec3d OA1 = pnts[0][0];
@@ -472,13 +558,10 @@ void SurfPatch::IntersectLineSeg( vec3d & p0, vec3d & p1, BndBox & line_box, vec
         return;
     }
 
-    SurfPatch bps[4];
-    split_patch( bps[0], bps[1], bps[2], bps[3] );      // Split Patch2 and Keep Subdividing
-
-    bps[0].IntersectLineSeg( p0, p1, line_box, t_vals );
-    bps[1].IntersectLineSeg( p0, p1, line_box, t_vals );
-    bps[2].IntersectLineSeg( p0, p1, line_box, t_vals );
-    bps[3].IntersectLineSeg( p0, p1, line_box, t_vals );
+    for ( int i = 0 ; i < 4 ; i++ )                    // Keep Subdividing - Split Kept For Next Seg
+    {
+        get_child( i )->IntersectLineSeg( p0, p1, line_box, t_vals );
+    }
 }
 
 void SurfPatch::AddTVal( double t, vector< double > & t_vals )
@@ -27,10 +27,12 @@
 
 #include <vector>
 #include <list>
+#include <atomic>
 using namespace std;
 
 class Surf;
 class SurfPatch;
+class IntersectSeg;
 
 //////////////////////////////////////////////////////////////////////
 class SurfPatch
@@ -38,6 +40,8 @@ class SurfPatch
 public:
 
     SurfPatch();
+    SurfPatch( const SurfPatch& copy );             // Copies Patch, Not Its Subdivision
+    SurfPatch& operator=( const SurfPatch& copy );
     virtual ~SurfPatch();
 
     void set_surf_ptr( Surf* ptr )
@@ -76,12 +80,17 @@ public:
     void split_patch( SurfPatch& bp00, SurfPatch& bp10, SurfPatch& bp01, SurfPatch& bp11 );
     bool test_planar( double tol );
 
+    //==== Persistent Subdivision - Split Once On First Use, Kept For Later Queries ====//
+    SurfPatch* get_child( int i );                  // bp00, bp10, bp01, bp11 Order Of split_patch
+    bool is_planar();                               // test_planar( DEFAULT_PLANE_TOL ), Cached
+    void clear_children();
+
     BndBox* get_bbox()
     {
         return &bnd_box;
     }
     friend void intersect( SurfPatch& bp1, SurfPatch& bp2 );
-    friend void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth );
+    friend void intersect( SurfPatch& bp1, SurfPatch& bp2, int depth, vector< IntersectSeg >* seg_buf );
     void find_closest_uw( vec3d& pnt_in, double guess_uw[2], double uw[2] );
     void find_closest_uw( vec3d& pnt_in, double uw[2] );
     vec3d comp_pnt_01( double u, double w );
@@ -105,7 +114,7 @@ public:
         return sub_depth;
     }
 
-    friend void intersect_quads( SurfPatch&  bp1, SurfPatch& bp2 );
+    friend void intersect_quads( SurfPatch&  bp1, SurfPatch& bp2, vector< IntersectSeg >* seg_buf );
 
 
     bool draw_flag;
@@ -122,6 +131,10 @@ protected:
 
     int sub_depth;
 
+    //==== Subdivision Tree - Shared By Concurrent Intersections, So Set Atomically ====//
+    std::atomic< SurfPatch* > m_Children;           // Array Of 4 Or NULL
+    std::atomic< int > m_PlanarState;               // -1 Unknown, 0 Not Planar, 1 Planar
+
 //  list <int_curve*> int_curve_ptr_list;
     void blend_funcs( double u, double& F1, double& F2, double& F3, double& F4 );
 
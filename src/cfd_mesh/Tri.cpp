@@ -446,6 +446,7 @@ Tri::Tri()
     e0 = e1 = e2 = NULL;
     interiorFlag = false;
     intExtCount = 0;
+    regionID = -1;
 }
 
 Tri::Tri( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 )
@@ -455,6 +456,7 @@ Tri::Tri( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 )
     SetNodesEdges( nn0, nn1, nn2, ee0, ee1, ee2 );
     interiorFlag = false;
     intExtCount = 0;
+    regionID = -1;
 }
 
 Tri::~Tri()
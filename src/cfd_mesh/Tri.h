@@ -45,7 +45,7 @@ public:
     }
     virtual ~Node();
 
-    list< Node* >::iterator list_ptr;
+    int list_ind;                   // Slot In Owning Mesh List
 
     bool m_DeleteMeFlag;
 
@@ -99,7 +99,7 @@ public:
     }
     virtual ~Edge()                         {}
 
-    list< Edge* >::iterator list_ptr;
+    int list_ind;                   // Slot In Owning Mesh List
 
     bool m_DeleteMeFlag;
 
@@ -161,7 +161,7 @@ public:
     Tri( Node* nn0, Node* nn1, Node* nn2, Edge* ee0, Edge* ee1, Edge* ee2 );
     virtual ~Tri();
 
-    list< Tri* >::iterator list_ptr;
+    int list_ind;                   // Slot In Owning Mesh List
     bool m_DeleteMeFlag;
 
     Node* n0;
@@ -207,6 +207,8 @@ public:
     void LoadAdjTris( int num_levels, set< Tri* > & triSet );
     int intExtCount;
 
+    int regionID;           // Connected Tris Not Crossing Border Edges
+
     unsigned char rgb[3];
 
 protected:
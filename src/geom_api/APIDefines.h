@@ -113,6 +113,10 @@ enum SLICE_STYLE {  SLICE_PLANAR,
                     SLICE_AWAVE,
                  };
 
+enum MASS_PROP_MODE {   MASS_PROP_SLICE,            // Slice Into Prisms
+                        MASS_PROP_SURF_INTEGRAL,    // Integrate Over Trimmed Surface
+                    };
+
 
 enum SET_TYPE { SET_ALL = 0,
                 SET_SHOWN = 1,
@@ -239,11 +239,11 @@ void SetComputationFileName( int file_type, const string & file_name )
 }
 
 /// Compute Mass Properties on The Components in the Set
-string ComputeMassProps( int set, int num_slices )
+string ComputeMassProps( int set, int num_slices, int mode )
 {
     Update();
 
-    string id = GetVehicle()->MassPropsAndFlatten( set, num_slices );
+    string id = GetVehicle()->MassPropsAndFlatten( set, num_slices, mode );
 
     if ( id.size() == 0 )
     {
@@ -1581,6 +1581,58 @@ double SetParmValUpdate( const string & geom_id, const string & name, const stri
     return p->SetFromDevice( val );         // Force Update
 }
 
+/// Set many parm values, then update each changed geom once.
+void SetParmValsUpdate( const vector< string > & parm_ids, const vector< double > & vals )
+{
+    if ( parm_ids.size() != vals.size() )
+    {
+        ErrorMgr.AddError( VSP_INDEX_OUT_RANGE, "SetParmValsUpdate::Number Of Parms And Vals Differ" );
+        return;
+    }
+
+    Vehicle* veh = GetVehicle();
+    veh->BeginParmTransaction();
+
+    string missing_id;
+    for ( int i = 0 ; i < ( int )parm_ids.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_ids[i] );
+        if ( !p )
+        {
+            missing_id = parm_ids[i];
+            continue;
+        }
+        p->SetFromDevice( vals[i] );
+    }
+
+    veh->CommitParmTransaction();
+
+    if ( missing_id.size() )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_PARM, "SetParmValsUpdate::Can't Find Parm " + missing_id );
+        return;
+    }
+    ErrorMgr.NoError();
+}
+
+/// Start deferring updates.  Parms set before CommitParmTransaction
+/// do not update their geom, links or the gui until the commit.
+void BeginParmTransaction()
+{
+    Vehicle* veh = GetVehicle();
+    veh->BeginParmTransaction();
+    ErrorMgr.NoError();
+}
+
+/// Propagate links and update each geom changed since BeginParmTransaction once.
+/// Nested transactions apply their changes at the outermost commit.
+void CommitParmTransaction()
+{
+    Vehicle* veh = GetVehicle();
+    veh->CommitParmTransaction();
+    ErrorMgr.NoError();
+}
+
 /// Get the value of parm
 double GetParmVal( const string & parm_id )
 {
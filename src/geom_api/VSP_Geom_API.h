@@ -49,7 +49,7 @@ extern string ImportFile( const string & file_name, int file_type, const string
 // jrg finish this stuff
 //extern void SetWorkingDir( const string & dir_name );
 extern void SetComputationFileName( int file_type, const string & file_name );
-extern string ComputeMassProps( int set, int num_slices );
+extern string ComputeMassProps( int set, int num_slices, int mode = MASS_PROP_SLICE );
 extern string ComputeCompGeom( int set, bool half_mesh, int file_export_types );
 extern string ComputePlaneSlice( int set, int num_slices, const vec3d & norm, bool auto_bnd,
                                  double start_bnd = 0, double end_bnd = 0 );
@@ -143,6 +143,9 @@ extern double SetParmVal( const string & geom_id, const string & name, const str
 extern double SetParmValLimits( const string & parm_id, double val, double lower_limit, double upper_limit );
 extern double SetParmValUpdate( const string & parm_id, double val );
 extern double SetParmValUpdate( const string & geom_id, const string & name, const string & group, double val );
+extern void SetParmValsUpdate( const vector< string > & parm_ids, const vector< double > & vals );
+extern void BeginParmTransaction();
+extern void CommitParmTransaction();
 extern double GetParmVal( const string & parm_id );
 extern double GetParmVal( const string & geom_id, const string & name, const string & group );
 extern int GetIntParmVal( const string & parm_id );
@@ -50,3 +50,13 @@ void BlankGeom::UpdateSurf()
 
     m_Origin = m_ModelMatrix.xform( vec3d( 0.0, 0.0, 0.0 ) );
 }
+
+//==== Origin Is Computed In UpdateSurf So Moving Must Rerun It ====//
+int BlankGeom::GetStageDirtyMask( int stage )
+{
+    if ( stage == STAGE_SURF )
+    {
+        return UPDATE_XFORM | UPDATE_SHAPE;
+    }
+    return Geom::GetStageDirtyMask( stage );
+}
@@ -31,6 +31,8 @@ public:
 
 protected:
 
+    virtual int GetStageDirtyMask( int stage );
+
 };
 
 #endif // !defined(VSPBLANKGEOM__INCLUDED_)
@@ -75,6 +75,9 @@ CfdMeshSettings::CfdMeshSettings() : ParmContainer()
     m_IntersectSubSurfs.Init( "IntersectSubSurfs", "Global", this, true, 0, 1 );
     m_IntersectSubSurfs.SetDescript( "Flag to intersect subsurfaces" );
 
+    m_VerifyIntRegionsFlag.Init( "VerifyIntRegions", "Global", this, false, 0, 1 );
+    m_VerifyIntRegionsFlag.SetDescript( "Flag to ray test extra triangles per region when removing interior triangles" );
+
     m_SelectedSetIndex.Init( "Set", "Global", this, 0, 0, 12 );
     m_SelectedSetIndex.SetDescript( "Selected set for operation" );
 
@@ -105,6 +105,14 @@ public:
     {
         return m_IntersectSubSurfs();
     }
+    virtual void SetVerifyIntRegionsFlag( bool f )
+    {
+        m_VerifyIntRegionsFlag = f;
+    }
+    virtual bool GetVerifyIntRegionsFlag()
+    {
+        return m_VerifyIntRegionsFlag();
+    }
 
     string GetExportFileName( int type );
     void SetExportFileName( const string &fn, int type );
@@ -149,6 +157,7 @@ public:
     BoolParm m_ColorTagsFlag;
 
     BoolParm m_IntersectSubSurfs;
+    BoolParm m_VerifyIntRegionsFlag;
 
     IntParm m_SelectedSetIndex;
 
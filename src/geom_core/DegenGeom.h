@@ -112,20 +112,34 @@ public:
     };
     virtual ~DegenGeom() {};
 
-    DegenPoint   getDegenPoint()
+    //==== Move Only - Results Can Be Large, Never Copy Them ====//
+    DegenGeom( DegenGeom && ) = default;
+    DegenGeom& operator=( DegenGeom && ) = default;
+    DegenGeom( const DegenGeom & ) = delete;
+    DegenGeom& operator=( const DegenGeom & ) = delete;
+
+    DegenPoint & getDegenPoint()
+    {
+        return degenPoint;
+    }
+    const DegenPoint & getDegenPoint() const
     {
         return degenPoint;
     }
-    DegenProp   getDegenProp()
+    DegenProp & getDegenProp()
+    {
+        return degenProp;
+    }
+    const DegenProp & getDegenProp() const
     {
         return degenProp;
     }
 
-    void setDegenPoint( DegenPoint degenPoint )
+    void setDegenPoint( const DegenPoint & degenPoint )
     {
         this->degenPoint = degenPoint;
     }
-    void setDegenProp( DegenProp degenProp )
+    void setDegenProp( const DegenProp & degenProp )
     {
         this->degenProp = degenProp;
     }
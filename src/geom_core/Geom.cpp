@@ -673,6 +673,8 @@ Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 
     m_WakeActiveFlag = false;
 
+    m_UpdateDirty = UPDATE_ALL;
+    ResetUpdateCounters();
 }
 //==== Destructor ====//
 Geom::~Geom()
@@ -764,26 +766,157 @@ void Geom::Update()
 {
     m_LateUpdateFlag = false;
 
-    Scale();
-    GeomXForm::Update();
+    //==== Collect What Changed - Update Without Changed Parms Redoes Everything ====//
+    int dirty = m_UpdateDirty;
+    if ( dirty == 0 && m_UpdatedParmVec.empty() )
+    {
+        dirty = UPDATE_ALL;
+    }
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+    {
+        dirty |= ClassifyParmChange( ParmMgr.FindParm( m_UpdatedParmVec[i] ) );
+    }
+    m_UpdateDirty = 0;
 
-    UpdateSurf();       // Must be implemented by subclass.
-    UpdateEndCaps();
-    UpdateFeatureLines();
-    UpdateSymmAttach();
+    m_NumUpdates++;
+    m_LastNumStagesRun = 0;
 
-    for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    if ( RunStage( STAGE_XFORM, dirty ) )
     {
-        m_SubSurfVec[i]->Update();
+        Scale();
+        GeomXForm::Update();
     }
 
-    UpdateChildren();
-    UpdateBBox();
-    UpdateDrawObj();
+    if ( RunStage( STAGE_SURF, dirty ) )
+    {
+        UpdateSurf();       // Must be implemented by subclass.
+    }
+    if ( RunStage( STAGE_END_CAPS, dirty ) )
+    {
+        UpdateEndCaps();
+    }
+    if ( RunStage( STAGE_FEATURE_LINES, dirty ) )
+    {
+        UpdateFeatureLines();
+    }
+    if ( RunStage( STAGE_SYMM_ATTACH, dirty ) )
+    {
+        UpdateSymmAttach();
+    }
+
+    if ( RunStage( STAGE_SUB_SURF, dirty ) )
+    {
+        for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+        {
+            m_SubSurfVec[i]->Update();
+        }
+    }
+
+    if ( RunStage( STAGE_CHILDREN, dirty ) )
+    {
+        UpdateChildren();
+    }
+    if ( RunStage( STAGE_BBOX, dirty ) )
+    {
+        UpdateBBox();
+    }
+    if ( RunStage( STAGE_DRAW_OBJ, dirty ) )
+    {
+        UpdateDrawObj();
+    }
 
     m_UpdatedParmVec.clear();
 }
 
+//==== Map A Changed Parm To The Kind Of Change It Makes ====//
+int Geom::ClassifyParmChange( Parm* parm_ptr )
+{
+    //==== Parms Of XSecs, Sub Containers Or Unknown Parms Can Change Anything ====//
+    if ( !parm_ptr || parm_ptr->GetContainer() != this )
+    {
+        return UPDATE_ALL;
+    }
+
+    //==== Scale Resizes The Shape Parms ====//
+    if ( parm_ptr == &m_Scale )
+    {
+        return UPDATE_SHAPE;
+    }
+    if ( parm_ptr == &m_TessU || parm_ptr == &m_TessW )
+    {
+        return UPDATE_TESS;
+    }
+
+    string group = parm_ptr->GetGroupName();
+    if ( group == "XForm" || group == "Attach" || group == "Sym" )
+    {
+        return UPDATE_XFORM;
+    }
+
+    //==== Inputs To Analyses And Outputs Of Update - Nothing To Redo ====//
+    if ( group == "Mass_Props" || group == "BBox" )
+    {
+        return 0;
+    }
+
+    return UPDATE_SHAPE;
+}
+
+//==== Kinds Of Change Each Stage Depends On ====//
+int Geom::GetStageDirtyMask( int stage )
+{
+    switch ( stage )
+    {
+    case STAGE_XFORM:
+        return UPDATE_XFORM | UPDATE_SHAPE;         // Scale And Rotation Center Depend On Shape
+    case STAGE_SURF:
+    case STAGE_END_CAPS:
+    case STAGE_FEATURE_LINES:
+        return UPDATE_SHAPE;                        // Main Surfs Are Built Untransformed
+    case STAGE_SYMM_ATTACH:
+    case STAGE_CHILDREN:
+    case STAGE_BBOX:
+        return UPDATE_XFORM | UPDATE_SHAPE;
+    case STAGE_SUB_SURF:
+        return UPDATE_XFORM | UPDATE_SHAPE | UPDATE_TESS;
+    case STAGE_DRAW_OBJ:
+        return UPDATE_ALL;
+    }
+    return UPDATE_ALL;
+}
+
+//==== Check If Stage Is Dirty And Count It ====//
+bool Geom::RunStage( int stage, int dirty )
+{
+    if ( !( dirty & GetStageDirtyMask( stage ) ) )
+    {
+        return false;
+    }
+
+    m_LastNumStagesRun++;
+    m_StageRunCount[stage]++;
+    return true;
+}
+
+void Geom::ResetUpdateCounters()
+{
+    m_NumUpdates = 0;
+    m_LastNumStagesRun = 0;
+    for ( int i = 0 ; i < NUM_UPDATE_STAGES ; i++ )
+    {
+        m_StageRunCount[i] = 0;
+    }
+}
+
+int Geom::GetStageRunCount( int stage )
+{
+    if ( stage < 0 || stage >= NUM_UPDATE_STAGES )
+    {
+        return 0;
+    }
+    return m_StageRunCount[stage];
+}
+
 void Geom::UpdateTesselate( int indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms,
                             vector< vector< vec3d > > &uw_pnts )
 {
@@ -970,6 +1103,7 @@ void Geom::UpdateChildren()
             // Ignore the abs location values and only use rel values for children so a child
             // with abs button selected stays attached to parent if the parent moves
             child->m_ignoreAbsFlag = true;
+            child->SetUpdateDirty( UPDATE_XFORM );
             child->Update();
             child->m_ignoreAbsFlag = false;
 
@@ -1093,6 +1227,7 @@ xmlNodePtr Geom::EncodeXml( xmlNodePtr & node )
 xmlNodePtr Geom::DecodeXml( xmlNodePtr & node )
 {
     GeomXForm::DecodeXml( node );
+    SetUpdateDirty( UPDATE_ALL );
 
     // Decode Material Info.
     m_GuiDraw.getMaterial()->DecodeNameXml( node );
@@ -1363,7 +1498,7 @@ void Geom::CreateDegenGeom( vector<DegenGeom> &dgs)
             degenGeom.createBodyDegenStick( pnts, uwpnts );
         }
 
-        dgs.push_back(degenGeom);
+        dgs.push_back( std::move( degenGeom ) );
     }
 }
 
@@ -1734,8 +1869,14 @@ void Geom::AddLinkableParms( vector< string > & linkable_parm_vec, const string
 
 void Geom::ChangeID( string id )
 {
+    string old_id = m_ID;
     ParmContainer::ChangeID( id );
 
+    if ( m_Vehicle )
+    {
+        m_Vehicle->ChangeGeomStoreID( old_id, this );
+    }
+
     for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i ++ )
     {
         m_SubSurfVec[i]->SetParentContainer( GetID() );
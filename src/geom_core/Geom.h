@@ -335,7 +335,34 @@ public:
     Geom( Vehicle* vehicle_ptr );
     virtual ~Geom();
 
+    //==== Kinds Of Change - Each Update Stage Is Dirtied By Some Of These ====//
+    enum { UPDATE_XFORM = 1, UPDATE_SHAPE = 2, UPDATE_TESS = 4,
+           UPDATE_ALL = UPDATE_XFORM | UPDATE_SHAPE | UPDATE_TESS,
+         };
+
+    //==== Update Stages In The Order They Run ====//
+    enum { STAGE_XFORM = 0, STAGE_SURF, STAGE_END_CAPS, STAGE_FEATURE_LINES, STAGE_SYMM_ATTACH,
+           STAGE_SUB_SURF, STAGE_CHILDREN, STAGE_BBOX, STAGE_DRAW_OBJ, NUM_UPDATE_STAGES,
+         };
+
     virtual void Update();
+    virtual void SetUpdateDirty( int flags )
+    {
+        m_UpdateDirty |= flags;
+    }
+
+    //==== Update Counters ====//
+    virtual void ResetUpdateCounters();
+    int GetNumUpdates()
+    {
+        return m_NumUpdates;
+    }
+    int GetLastNumStagesRun()
+    {
+        return m_LastNumStagesRun;
+    }
+    int GetStageRunCount( int stage );
+
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
     virtual void SetColor( int r, int g, int b );
@@ -562,6 +589,10 @@ public:
 
 protected:
 
+    virtual int ClassifyParmChange( Parm* parm_ptr );
+    virtual int GetStageDirtyMask( int stage );
+    virtual bool RunStage( int stage, int dirty );
+
     virtual void UpdateSurf() = 0;
     void UpdateEndCaps();
     virtual void UpdateFeatureLines();
@@ -604,6 +635,12 @@ protected:
     bool m_CapUMax;
     bool m_CapWMin;
     bool m_CapWMax;
+
+    //==== Update Pipeline State ====//
+    int m_UpdateDirty;                                  // Changes Not Yet Applied
+    int m_NumUpdates;
+    int m_LastNumStagesRun;
+    int m_StageRunCount[NUM_UPDATE_STAGES];
 };
 
 //==== GeomXSec  ====//
@@ -10,8 +10,13 @@
 #include "Parm.h"
 #include "Vehicle.h"
 #include "MeshGeom.h"
+#include "PodGeom.h"
+#include "LinkMgr.h"
+#include "ScriptMgr.h"
+#include "VehicleMgr.h"
 #include "StlHelper.h"
 #include <float.h>
+#include "Tritri.h"
 #include "APIDefines.h"
 
 
@@ -78,6 +83,19 @@ void GeomCoreTestSuite::VehicleTest()
     veh.AddActiveGeom( id3 );
     string id5 = veh.AddGeom( type );
 
+    //==== ID Index Follows Add, Delete And ID Changes ====//
+    TEST_ASSERT( veh.FindGeom( id2 ) != NULL && veh.FindGeom( id2 )->GetID() == id2 );
+    TEST_ASSERT( veh.FindGeom( "NONE" ) == NULL );
+
+    veh.SetActiveGeom( id4 );
+    veh.CutActiveGeomVec();
+    TEST_ASSERT( veh.FindGeom( id4 ) == NULL );
+
+    Geom* geom5 = veh.FindGeom( id5 );
+    geom5->ChangeID( "RENAMED_GEOM" );
+    TEST_ASSERT( veh.FindGeom( id5 ) == NULL );
+    TEST_ASSERT( veh.FindGeom( "RENAMED_GEOM" ) == geom5 );
+
     //vector< string > geom_vec = veh.GetGeomVec();
     //TEST_ASSERT( geom_vec[0] == id0 );
     //TEST_ASSERT( geom_vec[1] == id1 );
@@ -158,6 +176,20 @@ void GeomCoreTestSuite::WritePnts( std::vector< vec3d > & pnt_vec, std::string f
 
 }
 
+//==== Write Raw Bytes To File ====//
+void GeomCoreTestSuite::WriteBytes( const vector< char > & bytes, const string & file_name )
+{
+    FILE* fp = fopen( file_name.c_str(), "wb" );
+    if ( fp )
+    {
+        if ( bytes.size() )
+        {
+            fwrite( &bytes[0], bytes.size(), 1, fp );
+        }
+        fclose( fp );
+    }
+}
+
 void GeomCoreTestSuite::XmlTest()
 {
     xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
@@ -245,6 +277,365 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== TriBVH vs Brute Force Over All Tris On CompGeom Meshes - Same Answers ====//
+void GeomCoreTestSuite::TriBVHTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    veh.AddGeom( type );
+    type.m_Type = FUSELAGE_GEOM_TYPE;
+    veh.AddGeom( type );
+
+    string mesh_id = veh.AddMeshGeom( 0 );
+    MeshGeom* mesh = ( MeshGeom* )veh.FindGeom( mesh_id );
+    TEST_ASSERT( mesh != NULL );
+    if ( !mesh )
+    {
+        return;
+    }
+
+    vector< TMesh* > & tmesh_vec = mesh->m_TMeshVec;
+    TEST_ASSERT( tmesh_vec.size() == 2 );
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        tmesh_vec[i]->LoadBndBox();
+    }
+
+    //==== Ray Cast From Each Tri Like DeterIntExtTri ====//
+    vec3d dir( 1.0, 0.000001, 0.000001 );
+    int num_diff = 0;
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        for ( int t = 0 ; t < ( int )tmesh_vec[i]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh_vec[i]->m_TVec[t];
+            vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+            orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+
+            for ( int m = 0 ; m < ( int )tmesh_vec.size() ; m++ )
+            {
+                if ( m == i )
+                {
+                    continue;
+                }
+
+                vector< double > all_t;
+                for ( int k = 0 ; k < ( int )tmesh_vec[m]->m_TVec.size() ; k++ )
+                {
+                    TTri* ktri = tmesh_vec[m]->m_TVec[k];
+                    double tparm, uparm, vparm;
+                    if ( intersect_triangle( orig.v, dir.v, ktri->m_N0->m_Pnt.v, ktri->m_N1->m_Pnt.v, ktri->m_N2->m_Pnt.v,
+                                             &tparm, &uparm, &vparm ) && tparm > 0.0 )
+                    {
+                        bool dup_flag = false;
+                        for ( int j = 0 ; j < ( int )all_t.size() ; j++ )
+                        {
+                            dup_flag = dup_flag || fabs( tparm - all_t[j] ) < 0.0000001;
+                        }
+                        if ( !dup_flag )
+                        {
+                            all_t.push_back( tparm );
+                        }
+                    }
+                }
+
+                vector< double > bvh_t;
+                tmesh_vec[m]->m_TriBVH.RayCast( orig, dir, bvh_t );
+
+                if ( all_t.size() != bvh_t.size() )
+                {
+                    num_diff++;
+                }
+            }
+        }
+    }
+    TEST_ASSERT( num_diff == 0 );
+
+    //==== Tri/Tri Intersection Between The Two Meshes ====//
+    int num_all_isect = 0;
+    for ( int i = 0 ; i < ( int )tmesh_vec[0]->m_TVec.size() ; i++ )
+    {
+        TTri* t0 = tmesh_vec[0]->m_TVec[i];
+        for ( int j = 0 ; j < ( int )tmesh_vec[1]->m_TVec.size() ; j++ )
+        {
+            TTri* t1 = tmesh_vec[1]->m_TVec[j];
+            int coplanar_flag;
+            vec3d e0, e1;
+            if ( tri_tri_intersect_with_isectline( t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                                                   t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                                                   &coplanar_flag, e0.v, e1.v ) &&
+                    !coplanar_flag && dist( e0, e1 ) > 0.000001 )
+            {
+                num_all_isect++;
+            }
+        }
+    }
+
+    vector< pair< int, int > > bvh_pair_vec;
+    vector< TTriISect > bvh_isect_vec;
+    tmesh_vec[0]->m_TriBVH.AddOverlapLeafPairs( tmesh_vec[1]->m_TriBVH, bvh_pair_vec );
+    for ( int i = 0 ; i < ( int )bvh_pair_vec.size() ; i++ )
+    {
+        tmesh_vec[0]->m_TriBVH.IntersectLeaf( bvh_pair_vec[i].first, tmesh_vec[1]->m_TriBVH, bvh_pair_vec[i].second, bvh_isect_vec );
+    }
+
+    TEST_ASSERT( num_all_isect > 0 );
+    TEST_ASSERT( num_all_isect == ( int )bvh_isect_vec.size() );
+}
+
+//==== Only The Stages A Parm Change Dirties Should Run ====//
+void GeomCoreTestSuite::UpdateStageTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    string pod_id = veh.AddGeom( type );
+    PodGeom* pod = dynamic_cast< PodGeom* >( veh.FindGeom( pod_id ) );
+    TEST_ASSERT( pod != NULL );
+    if ( !pod )
+    {
+        return;
+    }
+
+    //==== Move - Surface Is Not Rebuilt ====//
+    pod->ResetUpdateCounters();
+    pod->m_XLoc.SetFromDevice( 2.0 );
+    TEST_ASSERT( pod->GetNumUpdates() == 1 );
+    TEST_ASSERT( pod->GetStageRunCount( Geom::STAGE_SURF ) == 0 );
+    TEST_ASSERT( pod->GetStageRunCount( Geom::STAGE_SYMM_ATTACH ) == 1 );
+    TEST_ASSERT( pod->GetStageRunCount( Geom::STAGE_DRAW_OBJ ) == 1 );
+
+    //==== Tessellation - Only Sub Surfs And Draw Objects ====//
+    pod->ResetUpdateCounters();
+    pod->m_TessU.SetFromDevice( 12 );
+    TEST_ASSERT( pod->GetLastNumStagesRun() == 2 );
+    TEST_ASSERT( pod->GetStageRunCount( Geom::STAGE_SUB_SURF ) == 1 );
+
+    //==== Mass Properties - Nothing To Redo ====//
+    pod->ResetUpdateCounters();
+    pod->m_Density.SetFromDevice( 3.0 );
+    TEST_ASSERT( pod->GetLastNumStagesRun() == 0 );
+
+    //==== Shape - Everything Runs ====//
+    pod->ResetUpdateCounters();
+    pod->m_Length.SetFromDevice( 20.0 );
+    TEST_ASSERT( pod->GetLastNumStagesRun() == Geom::NUM_UPDATE_STAGES );
+
+    //==== Bare Update Redoes Everything ====//
+    pod->ResetUpdateCounters();
+    pod->Update();
+    TEST_ASSERT( pod->GetLastNumStagesRun() == Geom::NUM_UPDATE_STAGES );
+
+    //==== Transaction - Several Changes, One Update At Commit ====//
+    pod->ResetUpdateCounters();
+    veh.BeginParmTransaction();
+    pod->m_Length.SetFromDevice( 22.0 );
+    pod->m_FineRatio.SetFromDevice( 12.0 );
+    pod->m_YLoc.SetFromDevice( 1.0 );
+    TEST_ASSERT( pod->GetNumUpdates() == 0 );
+    veh.CommitParmTransaction();
+    TEST_ASSERT( pod->GetNumUpdates() == 1 );
+    TEST_ASSERT( pod->GetLastNumStagesRun() == Geom::NUM_UPDATE_STAGES );
+    TEST_ASSERT_DELTA( pod->m_Length(), 22.0, 1e-12 );
+
+    //==== Internal Sets During A Transaction Are Not Deferred ====//
+    pod->ResetUpdateCounters();
+    veh.BeginParmTransaction();
+    pod->m_Length.Set( 24.0 );
+    pod->Update();
+    TEST_ASSERT( pod->GetNumUpdates() == 1 );
+    veh.CommitParmTransaction();
+    TEST_ASSERT( pod->GetNumUpdates() == 1 );
+
+    //==== Links From Internal Sets Fire At Once, Device Sets Wait For Commit ====//
+    Parm a, b;
+    a.Init( "A", "Link", NULL, 0.0, -1.0e12, 1.0e12 );
+    b.Init( "B", "Link", NULL, 1.0, -1.0e12, 1.0e12 );
+    LinkMgr.AddLink( a.GetID(), b.GetID() );            // Offset 1
+
+    veh.BeginParmTransaction();
+    a.Set( 4.0 );
+    TEST_ASSERT_DELTA( b(), 5.0, 1.0e-12 );
+    a.SetFromDevice( 6.0 );
+    TEST_ASSERT_DELTA( b(), 5.0, 1.0e-12 );
+    veh.CommitParmTransaction();
+    TEST_ASSERT_DELTA( b(), 7.0, 1.0e-12 );
+
+    LinkMgr.DelAllLinks();
+}
+
+//==== Links Propagate Along Chains, First Link To Reach A Parm Sets It ====//
+void GeomCoreTestSuite::LinkTest()
+{
+    Parm a, b, c, d, e;
+    a.Init( "A", "Link", NULL, 0.0, -1.0e12, 1.0e12 );
+    b.Init( "B", "Link", NULL, 1.0, -1.0e12, 1.0e12 );
+    c.Init( "C", "Link", NULL, 3.0, -1.0e12, 1.0e12 );
+    d.Init( "D", "Link", NULL, 20.0, -1.0e12, 1.0e12 );
+    e.Init( "E", "Link", NULL, 28.0, -1.0e12, 1.0e12 );
+
+    //==== Chain A -> B -> C ====//
+    LinkMgr.AddLink( a.GetID(), b.GetID() );            // Offset 1
+    LinkMgr.AddLink( b.GetID(), c.GetID() );            // Offset 2
+    a.Set( 10.0 );
+    TEST_ASSERT_DELTA( b(), 11.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( c(), 13.0, 1.0e-12 );
+
+    //==== Setting The Middle Only Moves What Is Downstream ====//
+    b.Set( 5.0 );
+    TEST_ASSERT_DELTA( a(), 10.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( c(), 7.0, 1.0e-12 );
+
+    //==== Diamond A -> B -> D, A -> C -> D ====//
+    LinkMgr.DelAllLinks();
+    a.Set( 0.0 );
+    b.Set( 1.0 );
+    c.Set( 2.0 );
+    d.Set( 20.0 );
+    LinkMgr.AddLink( a.GetID(), b.GetID() );            // Offset 1
+    LinkMgr.AddLink( b.GetID(), d.GetID() );            // Offset 19
+    LinkMgr.AddLink( a.GetID(), c.GetID() );            // Offset 2
+    c.Set( 5.0 );
+    LinkMgr.AddLink( c.GetID(), d.GetID() );            // Offset 15
+
+    a.Set( 10.0 );
+    TEST_ASSERT_DELTA( b(), 11.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( c(), 12.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( d(), 27.0, 1.0e-12 );            // Parm Without Links - Last Link Wins ( Through C )
+
+    //==== Once D Has Links It Is Held - First Link Wins ( Through B ) ====//
+    LinkMgr.AddLink( d.GetID(), e.GetID() );            // Offset 1
+    a.Set( 20.0 );
+    TEST_ASSERT_DELTA( b(), 21.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( c(), 22.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( d(), 40.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( e(), 41.0, 1.0e-12 );
+
+    //==== Cycle A -> B -> A Stops At A ====//
+    LinkMgr.DelAllLinks();
+    LinkMgr.AddLink( a.GetID(), b.GetID() );            // Offset 1
+    LinkMgr.AddLink( b.GetID(), a.GetID() );            // Offset -1
+    a.Set( 3.0 );
+    TEST_ASSERT_DELTA( a(), 3.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( b(), 4.0, 1.0e-12 );
+
+    LinkMgr.DelAllLinks();
+}
+
+//==== Surface Integral Mass Props Must Agree With Slice Mass Props ====//
+void GeomCoreTestSuite::MassPropTest()
+{
+    Vehicle veh;
+    GeomType type;
+    type.m_Type = POD_GEOM_TYPE;
+    PodGeom* pod1 = ( PodGeom* )veh.FindGeom( veh.AddGeom( type ) );
+    PodGeom* pod2 = ( PodGeom* )veh.FindGeom( veh.AddGeom( type ) );
+    TEST_ASSERT( pod1 && pod2 );
+    if ( !pod1 || !pod2 )
+    {
+        return;
+    }
+
+    //==== Overlapping, Off Axis - Trimming And Non-Zero CG Matter ====//
+    pod2->m_XLoc.Set( 3.0 );
+    pod2->m_YLoc.Set( 0.5 );
+    pod2->m_ZLoc.Set( 0.3 );
+    pod2->Update();
+
+    //==== Reference - Finely Sliced ====//
+    string id = veh.MassProps( 0, 400, vsp::MASS_PROP_SLICE );
+    TEST_ASSERT( id != "NONE" );
+    double slice_mass = veh.m_TotalMass;
+    vec3d slice_cg = veh.m_CG;
+    vec3d slice_I = veh.m_IxxIyyIzz;
+    veh.CutActiveGeomVec();
+    veh.DeleteClipBoard();
+
+    id = veh.MassProps( 0, 400, vsp::MASS_PROP_SURF_INTEGRAL );
+    TEST_ASSERT( id != "NONE" );
+    double surf_mass = veh.m_TotalMass;
+    vec3d surf_cg = veh.m_CG;
+    vec3d surf_I = veh.m_IxxIyyIzz;
+    veh.CutActiveGeomVec();
+    veh.DeleteClipBoard();
+
+    TEST_ASSERT( slice_mass > 0.0 );
+    TEST_ASSERT_DELTA( surf_mass / slice_mass, 1.0, 0.01 );
+
+    double len = pod1->m_Length();
+    TEST_ASSERT_DELTA( dist( surf_cg, slice_cg ) / len, 0.0, 0.01 );
+
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        TEST_ASSERT( slice_I[i] > 0.0 );
+        TEST_ASSERT_DELTA( surf_I[i] / slice_I[i], 1.0, 0.02 );
+    }
+}
+
+//==== Byte Code Cache - Round Trip, Rejects Stale And Damaged Files ====//
+void GeomCoreTestSuite::ByteCodeTest()
+{
+    //==== Vehicle Init Sets Up The Script Engine ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    string bc_file = "ByteCodeTest.asbc";
+    string content = "void main() { AddGeom( \"POD\" ); }\n";
+    remove( bc_file.c_str() );
+
+    //==== Compiling Writes The Byte Code File ====//
+    string module_name = ScriptMgr.ReadScriptFromMemory( "ByteCodeTest", content, bc_file );
+    TEST_ASSERT( module_name.size() > 0 );
+
+    vector< char > bytes;
+    FILE* fp = fopen( bc_file.c_str(), "rb" );
+    TEST_ASSERT( fp != NULL );
+    if ( fp )
+    {
+        char buff[512];
+        size_t num;
+        while ( ( num = fread( buff, 1, sizeof( buff ), fp ) ) > 0 )
+        {
+            bytes.insert( bytes.end(), buff, buff + num );
+        }
+        fclose( fp );
+    }
+    TEST_ASSERT( bytes.size() > 16 );
+    if ( bytes.size() <= 16 )
+    {
+        return;
+    }
+
+    //==== Round Trip - Loaded Module Runs ====//
+    TEST_ASSERT( ScriptMgr.LoadByteCode( "ByteCodeTestLoad", content, bc_file ) );
+    int num_geom = ( int )veh->GetGeomVec().size();
+    ScriptMgr.ExecuteScript( "ByteCodeTestLoad", "void main()" );
+    TEST_ASSERT( ( int )veh->GetGeomVec().size() == num_geom + 1 );
+
+    //==== Script Changed ====//
+    TEST_ASSERT( !ScriptMgr.LoadByteCode( "ByteCodeTestStale", content + "\n", bc_file ) );
+
+    //==== Engine Signature Changed - Follows 8 Byte Magic ====//
+    vector< char > stale_bytes = bytes;
+    stale_bytes[8] ^= 1;
+    WriteBytes( stale_bytes, bc_file );
+    TEST_ASSERT( !ScriptMgr.LoadByteCode( "ByteCodeTestStale", content, bc_file ) );
+
+    //==== Truncated In Header And In Byte Code ====//
+    WriteBytes( vector< char >( bytes.begin(), bytes.begin() + 16 ), bc_file );
+    TEST_ASSERT( !ScriptMgr.LoadByteCode( "ByteCodeTestShort", content, bc_file ) );
+
+    WriteBytes( vector< char >( bytes.begin(), bytes.end() - 1 ), bc_file );
+    TEST_ASSERT( !ScriptMgr.LoadByteCode( "ByteCodeTestShort", content, bc_file ) );
+
+    //==== Intact File Still Loads ====//
+    WriteBytes( bytes, bc_file );
+    TEST_ASSERT( ScriptMgr.LoadByteCode( "ByteCodeTestReload", content, bc_file ) );
+
+    remove( bc_file.c_str() );
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
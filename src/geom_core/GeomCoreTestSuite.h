@@ -27,6 +27,11 @@ public:
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::TriBVHTest )
+        TEST_ADD( GeomCoreTestSuite::UpdateStageTest )
+        TEST_ADD( GeomCoreTestSuite::LinkTest )
+        TEST_ADD( GeomCoreTestSuite::MassPropTest )
+        TEST_ADD( GeomCoreTestSuite::ByteCodeTest )
     }
 
 private:
@@ -36,10 +41,16 @@ private:
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void TriBVHTest();
+    void UpdateStageTest();
+    void LinkTest();
+    void MassPropTest();
+    void ByteCodeTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
 
     void WritePnts( std::vector< vec3d > & pnt_vec, std::string file_name );
+    void WriteBytes( const vector< char > & bytes, const string & file_name );
 
 };
 
@@ -391,6 +391,12 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos )
     return ( m_Len + fract * ( base_len - m_Len  ) );
 }
 
+BndBox PointSimpleSource::GetInfluenceBox()
+{
+    vec3d r( m_Rad, m_Rad, m_Rad );
+    return BndBox( m_Loc - r, m_Loc + r );
+}
+
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     vec3d p = geomPtr->GetUWPt( m_SurfIndx, m_ULoc, m_WLoc );
@@ -576,6 +582,17 @@ double LineSimpleSource::GetTargetLen( double base_len, vec3d &  pos )
     return retlen;
 }
 
+BndBox LineSimpleSource::GetInfluenceBox()
+{
+    //==== Radius Varies Linearly Along Line - End Spheres Bound It ====//
+    vec3d r1( m_Rad, m_Rad, m_Rad );
+    vec3d r2( m_Rad2, m_Rad2, m_Rad2 );
+    BndBox box( m_Pnt1 - r1, m_Pnt1 + r1 );
+    box.Update( m_Pnt2 - r2 );
+    box.Update( m_Pnt2 + r2 );
+    return box;
+}
+
 void LineSimpleSource::Update( Geom* geomPtr )
 {
     m_Pnt1 = geomPtr->GetUWPt( m_SurfIndx, m_ULoc1, m_WLoc1 );
@@ -764,6 +781,11 @@ double BoxSimpleSource::GetTargetLen( double base_len, vec3d &  pos )
     return ( m_Len + max_fract * ( base_len - m_Len  ) );
 }
 
+BndBox BoxSimpleSource::GetInfluenceBox()
+{
+    return BndBox( m_CullMinPnt, m_CullMaxPnt );
+}
+
 void BoxSimpleSource::Update( Geom* geomPtr )
 {
     BndBox box;
@@ -848,6 +870,13 @@ void BoxSimpleSource::Highlight( bool flag )
 GridDensity::GridDensity() : ParmContainer()
 {
     m_GroupName = "NONE";
+
+    m_SourceIndexDirty = true;
+    for ( int d = 0 ; d < 3 ; d++ )
+    {
+        m_SourceIndexDim[d] = 0;
+        m_SourceIndexCellSize[d] = 1.0;
+    }
 }
 
 void GridDensity::InitParms()
@@ -964,9 +993,67 @@ double GridDensity::GetTargetLen( vec3d& pos, bool farFlag )
         target_len = m_FarMaxLen();
     }
 
-    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    if ( m_SourceIndexDirty )
     {
-        double len = m_Sources[i]->GetTargetLen( target_len, pos );
+        BuildSourceIndex();
+    }
+
+    return ApplySources( target_len, pos );
+}
+
+void GridDensity::GetTargetLen( vector< vec3d > & pos_vec, vector< double > & len_vec, bool farFlag )
+{
+    double base_len;
+
+    if( !farFlag )
+    {
+        base_len = m_BaseLen();
+    }
+    else
+    {
+        base_len = m_FarMaxLen();
+    }
+
+    if ( m_SourceIndexDirty )
+    {
+        BuildSourceIndex();
+    }
+
+    len_vec.resize( pos_vec.size() );
+    for ( int i = 0 ; i < ( int )pos_vec.size() ; i++ )
+    {
+        len_vec[i] = ApplySources( base_len, pos_vec[i] );
+    }
+}
+
+void GridDensity::UpdateSourceIndex()
+{
+    if ( m_SourceIndexDirty )
+    {
+        BuildSourceIndex();
+    }
+}
+
+//==== Only Sources Whose Influence Box Holds pos Can Reduce The Length ====//
+double GridDensity::ApplySources( double target_len, vec3d & pos )
+{
+    if ( m_SourceIndexCells.empty() || !m_SourceIndexBox.CheckPnt( pos ) )
+    {
+        return target_len;
+    }
+
+    int ic[3];
+    for ( int d = 0 ; d < 3 ; d++ )
+    {
+        ic[d] = ( int )( ( pos[d] - m_SourceIndexBox.GetMin( d ) ) / m_SourceIndexCellSize[d] );
+        ic[d] = min( max( ic[d], 0 ), m_SourceIndexDim[d] - 1 );
+    }
+
+    // Sources are applied in their original order, as each one blends toward the running length
+    const vector< int > & cell = m_SourceIndexCells[ ic[0] + m_SourceIndexDim[0] * ( ic[1] + m_SourceIndexDim[1] * ic[2] ) ];
+    for ( int i = 0 ; i < ( int )cell.size() ; i++ )
+    {
+        double len = m_Sources[ cell[i] ]->GetTargetLen( target_len, pos );
         if ( len < target_len )
         {
             target_len = len;
@@ -975,12 +1062,77 @@ double GridDensity::GetTargetLen( vec3d& pos, bool farFlag )
     return target_len;
 }
 
+void GridDensity::BuildSourceIndex()
+{
+    m_SourceIndexDirty = false;
+    m_SourceIndexBox = BndBox();
+    m_SourceIndexCells.clear();
+
+    if ( m_Sources.empty() )
+    {
+        return;
+    }
+
+    vector< BndBox > src_box( m_Sources.size() );
+    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    {
+        src_box[i] = m_Sources[i]->GetInfluenceBox();
+        m_SourceIndexBox.Update( src_box[i] );
+    }
+
+    //==== Aim For A Few Cells Per Source, Shaped To The Overall Box ====//
+    double ext[3];
+    double vol = 1.0;
+    double tiny = 1.0e-6 * max( m_SourceIndexBox.GetLargestDist(), 1.0e-12 );
+    for ( int d = 0 ; d < 3 ; d++ )
+    {
+        ext[d] = max( m_SourceIndexBox.GetMax( d ) - m_SourceIndexBox.GetMin( d ), tiny );
+        vol *= ext[d];
+    }
+    int num_target = min( 8 * ( int )m_Sources.size(), 32768 );
+    double cell = pow( vol / num_target, 1.0 / 3.0 );
+
+    int num_cells = 1;
+    for ( int d = 0 ; d < 3 ; d++ )
+    {
+        m_SourceIndexDim[d] = min( max( ( int )ceil( ext[d] / cell ), 1 ), 64 );
+        m_SourceIndexCellSize[d] = ext[d] / m_SourceIndexDim[d];
+        num_cells *= m_SourceIndexDim[d];
+    }
+    m_SourceIndexCells.resize( num_cells );
+
+    //==== Add Each Source To Every Cell Its Box Overlaps ====//
+    for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
+    {
+        int lo[3], hi[3];
+        for ( int d = 0 ; d < 3 ; d++ )
+        {
+            lo[d] = ( int )( ( src_box[i].GetMin( d ) - m_SourceIndexBox.GetMin( d ) ) / m_SourceIndexCellSize[d] );
+            hi[d] = ( int )( ( src_box[i].GetMax( d ) - m_SourceIndexBox.GetMin( d ) ) / m_SourceIndexCellSize[d] );
+            lo[d] = min( max( lo[d], 0 ), m_SourceIndexDim[d] - 1 );
+            hi[d] = min( max( hi[d], 0 ), m_SourceIndexDim[d] - 1 );
+        }
+
+        for ( int k = lo[2] ; k <= hi[2] ; k++ )
+        {
+            for ( int j = lo[1] ; j <= hi[1] ; j++ )
+            {
+                for ( int l = lo[0] ; l <= hi[0] ; l++ )
+                {
+                    m_SourceIndexCells[ l + m_SourceIndexDim[0] * ( j + m_SourceIndexDim[1] * k ) ].push_back( i );
+                }
+            }
+        }
+    }
+}
+
 void GridDensity::ScaleAllSources( double scale )
 {
     for ( int i = 0 ; i < ( int )m_Sources.size() ; i++ )
     {
         m_Sources[i]->AdjustLen( scale );
     }
+    m_SourceIndexDirty = true;
 }
 
 
@@ -207,6 +207,9 @@ public:
 
     virtual double GetTargetLen( double base_len, vec3d &  pos ) = 0;
 
+    //==== Box Outside Of Which GetTargetLen Returns base_len Unchanged ====//
+    virtual BndBox GetInfluenceBox() = 0;
+
     virtual int GetType()
     {
         return m_Type;
@@ -255,6 +258,7 @@ public:
     }
 
     double GetTargetLen( double base_len, vec3d &  pos );
+    virtual BndBox GetInfluenceBox();
 
     virtual void Update( Geom* geomPtr );
 
@@ -289,6 +293,7 @@ public:
     virtual void AdjustLen( double val  );
 
     double GetTargetLen( double base_len, vec3d &  pos );
+    virtual BndBox GetInfluenceBox();
 
     virtual void Update( Geom* geomPtr );
 
@@ -335,6 +340,7 @@ public:
     void ComputeCullPnts();
 
     double GetTargetLen( double base_len, vec3d &  pos );
+    virtual BndBox GetInfluenceBox();
 
     void Update( Geom* geomPtr );
 
@@ -420,15 +426,21 @@ public:
     double GetFarRadFrac();
 
     double GetTargetLen( vec3d& pos, bool farFlag = false );
+    void GetTargetLen( vector< vec3d > & pos_vec, vector< double > & len_vec, bool farFlag = false );
 
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        m_SourceIndexDirty = true;
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        m_SourceIndexDirty = true;
     }
+
+    //==== Rebuilt Lazily On Query - Call First If Querying From Several Threads ====//
+    void UpdateSourceIndex();
     int  GetNumSources()
     {
         return m_Sources.size();
@@ -455,6 +467,16 @@ protected:
     string m_GroupName;
     vector< BaseSimpleSource* > m_Sources;                // Sources + Ref Sources in 3D Space
 
+    //==== Uniform Grid Of Source Indices Over Their Influence Boxes ====//
+    double ApplySources( double target_len, vec3d & pos );
+    void BuildSourceIndex();
+
+    bool m_SourceIndexDirty;
+    BndBox m_SourceIndexBox;
+    int m_SourceIndexDim[3];
+    double m_SourceIndexCellSize[3];
+    vector< vector< int > > m_SourceIndexCells;         // Ascending Source Indices Per Cell
+
 };
 
 class CfdGridDensity : public GridDensity
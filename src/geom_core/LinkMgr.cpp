@@ -51,6 +51,7 @@ void LinkMgrSingleton::Wype()
 
     DelAllLinks();
     m_LinkVec = deque< Link* >();
+    m_SourceLinkMap.clear();
 
     m_UpdatedParmVec = vector< string >();
 
@@ -145,6 +146,7 @@ void LinkMgrSingleton::CheckLinks()
 
     for ( int i = 0 ; i < ( int )del_indices.size() ; i++ )
     {
+        UnIndexLink( m_LinkVec[ del_indices[i] ] );
         m_LinkVec.erase( m_LinkVec.begin() + del_indices[i] );
     }
 
@@ -178,10 +180,16 @@ bool LinkMgrSingleton::AddCurrLink()
 //==== Check For Duplicate Link  ====//
 bool LinkMgrSingleton::CheckForDuplicateLink( const string & pA, const string &  pB )
 {
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    unordered_map< string, vector< Link* > >::const_iterator iter = m_SourceLinkMap.find( pA );
+    if ( iter == m_SourceLinkMap.end() )
+    {
+        return false;
+    }
+
+    const vector< Link* > & link_vec = iter->second;
+    for ( int i = 0 ; i < ( int )link_vec.size() ; i++ )
     {
-        if ( m_LinkVec[i]->GetParmA() == pA &&
-                m_LinkVec[i]->GetParmB() == pB )
+        if ( link_vec[i]->GetParmB() == pB )
         {
             return true;
         }
@@ -189,17 +197,41 @@ bool LinkMgrSingleton::CheckForDuplicateLink( const string & pA, const string &
     return false;
 }
 
+//==== Add Link To Source Parm Index ====//
+void LinkMgrSingleton::IndexLink( Link* link )
+{
+    m_SourceLinkMap[ link->GetParmA() ].push_back( link );
+}
+
+//==== Remove Link From Source Parm Index ====//
+void LinkMgrSingleton::UnIndexLink( Link* link )
+{
+    unordered_map< string, vector< Link* > >::iterator iter = m_SourceLinkMap.find( link->GetParmA() );
+    if ( iter != m_SourceLinkMap.end() )
+    {
+        vector_remove_val( iter->second, link );
+        if ( iter->second.empty() )
+        {
+            m_SourceLinkMap.erase( iter );
+        }
+    }
+}
+
+//==== Add Decoded Link ====//
+void LinkMgrSingleton::AddLink( Link* link )
+{
+    m_LinkVec.push_back( link );
+    IndexLink( link );
+}
+
 
 //==== Add New Link ====//
 bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
 {
     //==== Make Sure Parm Are Not Already Linked ====//
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    if ( CheckForDuplicateLink( pidA, pidB ) )
     {
-        if ( m_LinkVec[i]->GetParmA() == pidA && m_LinkVec[i]->GetParmB() == pidB  )
-        {
-            return false;
-        }
+        return false;
     }
 
     //==== Check If ParmIDs Are Valid ====//
@@ -224,6 +256,7 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB )
     pB->SetLinkedFlag( true );
 
     m_LinkVec.push_back( pl );
+    IndexLink( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
 
     return true;
@@ -239,6 +272,7 @@ void LinkMgrSingleton::DelCurrLink()
 
     Link* pl = m_LinkVec[m_CurrLinkIndex];
 
+    UnIndexLink( pl );
     m_LinkVec.erase( m_LinkVec.begin() +  m_CurrLinkIndex );
 
     if ( pl )
@@ -261,6 +295,7 @@ void LinkMgrSingleton::DelAllLinks()
     }
 
     m_LinkVec.clear();
+    m_SourceLinkMap.clear();
     m_CurrLinkIndex = -1;
 }
 //==== Link All Parms In A Group ====//
@@ -377,21 +412,19 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
     AdvLinkMgr.ParmChanged( pid, start_flag );
 
     //==== Look for Links and Modify Linked Parms ====//
-    vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
-    {
-        if ( m_LinkVec[i]->GetParmA() == pid )
-        {
-            parm_link_vec.push_back( m_LinkVec[i] );
-        }
-    }
+    unordered_map< string, vector< Link* > >::const_iterator iter = m_SourceLinkMap.find( pid );
 
     //==== No Links ====//
-    if ( parm_link_vec.size() == 0 )
+    if ( iter == m_SourceLinkMap.end() )
     {
         return;
     }
 
+    //==== Copy - Setting Linked Parms Can Add Or Remove Links ====//
+    vector < Link* > parm_link_vec = iter->second;
+
+    bool outer_flag = m_UpdatedParmVec.empty();
+
     parm_ptr->SetLinkUpdateFlag( true );
     m_UpdatedParmVec.push_back( parm_ptr->GetID() );
 
@@ -430,24 +463,26 @@ void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
         }
     }
 
-    if ( start_flag )                                       // Clean Up
+    if ( start_flag || outer_flag )                         // Clean Up
     {
         for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
         {
-            Parm* parm_ptr = ParmMgr.FindParm( m_UpdatedParmVec[i] );
-            if ( parm_ptr )
+            Parm* updated_ptr = ParmMgr.FindParm( m_UpdatedParmVec[i] );
+            if ( updated_ptr )
             {
-                parm_ptr->SetLinkUpdateFlag( false );
+                updated_ptr->SetLinkUpdateFlag( false );
             }
         }
         m_UpdatedParmVec.clear();
+    }
 
+    if ( start_flag )
+    {
         Vehicle* veh = VehicleMgr.GetVehicle();
         if ( veh )
         {
             veh->ParmChanged( parm_ptr, Parm::SET );
         }
-
     }
 
 }
@@ -13,9 +13,11 @@
 
 #include "Link.h"
 #include <deque>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
 
 
 //==== Parm Link Manager ====//
@@ -43,7 +45,7 @@ public:
     virtual bool CheckForDuplicateLink( const string & pA, const string &  pB );
 
     virtual bool AddLink( const string& pA, const string& pB );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link );
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
 
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
@@ -90,6 +92,9 @@ private:
     void Init();
     void Wype();
 
+    void IndexLink( Link* link );
+    void UnIndexLink( Link* link );
+
     int m_CurrLinkIndex;
     Link *m_WorkingLink;
 
@@ -97,6 +102,8 @@ private:
 
     deque< Link* > m_LinkVec;
 
+    unordered_map< string, vector< Link* > > m_SourceLinkMap;  // ParmA ID->Links, In m_LinkVec Order
+
     vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
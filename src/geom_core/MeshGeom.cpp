@@ -27,6 +27,7 @@
 #include "StringUtil.h"
 
 #include "SubSurfaceMgr.h"
+#include "ThreadUtil.h"
 #include <set>
 #include <map>
 
@@ -587,6 +588,112 @@ int MeshGeom::ReadTriFile( const char * file_name )
     return 1;
 }
 
+//==== Intersect Every Pair Of TMeshes ====//
+void MeshGeom::IntersectTMeshes()
+{
+    //==== Gather Overlapping Leaf Pairs In A Fixed Order ====//
+    vector< pair< int, int > > meshPairVec;
+    vector< pair< int, int > > leafPairVec;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        {
+            m_TMeshVec[i]->m_TriBVH.AddOverlapLeafPairs( m_TMeshVec[j]->m_TriBVH, leafPairVec );
+            meshPairVec.resize( leafPairVec.size(), pair< int, int >( i, j ) );
+        }
+    }
+
+    //==== Intersect Leaf Pairs Concurrently ====//
+    vector< vector< TTriISect > > isectVec( leafPairVec.size() );
+    ThreadUtil::ParallelFor( ( int )leafPairVec.size(), [&]( int i, int thread_index )
+    {
+        TMesh* tm0 = m_TMeshVec[ meshPairVec[i].first ];
+        TMesh* tm1 = m_TMeshVec[ meshPairVec[i].second ];
+        tm0->m_TriBVH.IntersectLeaf( leafPairVec[i].first, tm1->m_TriBVH, leafPairVec[i].second, isectVec[i] );
+    } );
+
+    //==== Add ISect Edges To Tris In Serial Order ====//
+    for ( int i = 0 ; i < ( int )isectVec.size() ; i++ )
+    {
+        for ( int k = 0 ; k < ( int )isectVec[i].size() ; k++ )
+        {
+            isectVec[i][k].AddISectEdges();
+        }
+    }
+}
+
+//==== Each TMesh Only Splits Its Own Tris ====//
+void MeshGeom::SplitTMeshes( int meshFlag )
+{
+    ThreadUtil::ParallelFor( ( int )m_TMeshVec.size(), [&]( int i, int thread_index )
+    {
+        m_TMeshVec[i]->Split( meshFlag );
+    } );
+}
+
+//==== Ray Cast Each Tri Against The Other TMeshes ====//
+void MeshGeom::DeterIntExtTMeshes()
+{
+    vector< pair< TMesh*, TTri* > > triVec;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int t = 0 ; t < ( int )m_TMeshVec[i]->m_TVec.size() ; t++ )
+        {
+            triVec.push_back( pair< TMesh*, TTri* >( m_TMeshVec[i], m_TMeshVec[i]->m_TVec[t] ) );
+        }
+    }
+
+    ThreadUtil::ParallelFor( ( int )triVec.size(), [&]( int i, int thread_index )
+    {
+        triVec[i].first->DeterIntExtParentTri( triVec[i].second, m_TMeshVec );
+    } );
+}
+
+//==== Slices Run Concurrently - m_TMeshVec Is Only Read (BVH Leaf Pairs And Ray Casts) ====//
+void MeshGeom::SliceTMeshes( bool massFlag )
+{
+    ThreadUtil::ParallelFor( ( int )m_SliceVec.size(), [&]( int s, int thread_index )
+    {
+        TMesh* tm = m_SliceVec[s];
+        tm->LoadBndBox();
+
+        //==== Intersect All Mesh Geoms ====//
+        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            tm->IntersectSlice( m_TMeshVec[i] );
+        }
+
+        //==== Split Intersected Tri in Mesh ====//
+        tm->Split();
+
+        //==== Determine Which Triangle Are Interior/Exterior ====//
+        if ( massFlag )
+        {
+            tm->MassDeterIntExt( m_TMeshVec );
+            return;
+        }
+
+        tm->DeterIntExt( m_TMeshVec );
+
+        //==== Flip Int/Ext Flags ====//
+        for ( int i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        {
+            TTri* tri = tm->m_TVec[i];
+            if ( tri->m_SplitVec.size() )
+            {
+                for ( int j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                {
+                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
+                }
+            }
+            else
+            {
+                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
+            }
+        }
+    } );
+}
+
 //==== Build Indexed Mesh ====//
 void MeshGeom::BuildIndexedMesh( int partOffset )
 {
@@ -646,30 +753,26 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
         return;
     }
 
-    //==== Build Map ====//
-    PntNodeCloud pnCloud;
-    pnCloud.AddPntNodes( allPntVec );
-
     //==== Compute Tol ====//
+    // The KD-tree radius search this replaced compared squared distances, so keep the same weld distance
     BndBox bb = m_Vehicle->GetBndBox();
-    double tol = bb.GetLargestDist() * 1.0e-10;
+    double tol = sqrt( bb.GetLargestDist() * 1.0e-10 );
 
-    //==== Use NanoFlann to Find Close Points and Group ====//
-    IndexPntNodes( pnCloud, tol );
+    //==== Weld Close Points ====//
+    vector< int > pntMap;
+    vector< int > usedPntVec;
+    WeldPnts( allPntVec, tol, pntMap, usedPntVec );
 
     //==== Load Used Nodes ====//
-    for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )usedPntVec.size() ; i++ )
     {
-        if ( pnCloud.UsedNode( i ) )
-        {
-            m_IndexedNodeVec.push_back( allNodeVec[i] );
-        }
+        m_IndexedNodeVec.push_back( allNodeVec[ usedPntVec[i] ] );
     }
 
     //==== Set Adjusted Node IDs ====//
     for ( int i = 0 ; i < ( int )allNodeVec.size() ; i++ )
     {
-        allNodeVec[i]->m_ID = pnCloud.GetNodeUsedIndex( i );
+        allNodeVec[i]->m_ID = pntMap[i];
     }
 
     //==== Remove Any Bogus Tris ====//
@@ -1320,7 +1423,7 @@ void MeshGeom::TransformMeshVec( vector<TMesh*> & meshVec, Matrix4d & TransMat )
 
 void MeshGeom::IntersectTrim( int meshf, int halfFlag, int intSubsFlag )
 {
-    int i, j;
+    int i;
 
     m_MeshFlag = meshf;
 
@@ -1413,9 +1516,9 @@ void MeshGeom::IntersectTrim( int meshf, int halfFlag, int intSubsFlag )
                 // Split the triangles
                 m_TMeshVec[i]->Split();
 
-                // Make current TMesh XYZ again and reset its octtree
+                // Make current TMesh XYZ again and reset its bounds
                 m_TMeshVec[i]->MakeNodePntXYZ();
-                m_TMeshVec[i]->m_TBox.Reset();
+                m_TMeshVec[i]->m_BndBox.Reset();
 
                 // Flatten Mesh
                 TMesh* f_tmesh = new TMesh();
@@ -1443,31 +1546,19 @@ void MeshGeom::IntersectTrim( int meshf, int halfFlag, int intSubsFlag )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_BndBox );
     }
     m_BBox = b;
     //update_xformed_bbox();            // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshes();
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split( m_MeshFlag );
-    }
+    SplitTMeshes( m_MeshFlag );
 
     //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    DeterIntExtTMeshes();
 
     if ( halfFlag )
     {
@@ -1658,7 +1749,7 @@ void MeshGeom::IntersectTrim( int meshf, int halfFlag, int intSubsFlag )
 
 void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
 {
-    int i, j;
+    int i;
 
     m_MeshFlag = 0;
 
@@ -1700,31 +1791,19 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_BndBox );
     }
     m_BBox = b;
     //update_xformed_bbox();          // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshes();
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split( m_MeshFlag );
-    }
+    SplitTMeshes( m_MeshFlag );
 
     //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    DeterIntExtTMeshes();
 
     //===== Reset Scale =====//
     m_Scale = 1;
@@ -1806,14 +1885,12 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
 
     for ( i = 0; i < ( int )degenGeom.size(); i++ )
     {
-        DegenPoint degenPoint = degenGeom[i].getDegenPoint();
+        DegenPoint & degenPoint = degenGeom[i].getDegenPoint();
 
         degenPoint.area.push_back( m_TMeshVec[i]->m_TheoArea );
         degenPoint.areaWet.push_back( m_TMeshVec[i]->m_WetArea );
         degenPoint.vol.push_back( m_TMeshVec[i]->m_TheoVol );
         degenPoint.volWet.push_back( m_TMeshVec[i]->m_WetVol );
-
-        degenGeom[i].setDegenPoint( degenPoint );
     }
 }
 
@@ -1865,7 +1942,7 @@ void MeshGeom::SliceX( int numSlices )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_BndBox );
     }
     m_BBox = b;
     //update_xformed_bbox();            // Load Xform BBox
@@ -1907,53 +1984,8 @@ void MeshGeom::SliceX( int numSlices )
         }
     }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Flip Int/Ext Flags ====//
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
-                }
-            }
-            else
-            {
-                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
-            }
-        }
-    }
+    //==== Intersect, Split And Classify Slices ====//
+    SliceTMeshes( false );
 
     //==== Delete Mesh Geometry ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2109,7 +2141,7 @@ void MeshGeom::AreaSlice( int style, int numSlices, double sliceAngle, double co
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_BndBox );
     }
     m_BBox = b;
     //update_xformed_bbox();            // Load Xform BBox
@@ -2254,53 +2286,8 @@ void MeshGeom::AreaSlice( int style, int numSlices, double sliceAngle, double co
     }
 
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->DeterIntExt( m_TMeshVec );
-
-        //==== Flip Int/Ext Flags ====//
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
-                }
-            }
-            else
-            {
-                tri->m_InteriorFlag = !( tri->m_InteriorFlag );
-            }
-        }
-    }
+    //==== Intersect, Split And Classify Slices ====//
+    SliceTMeshes( false );
     //==== Delete Mesh Geometry ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
@@ -2460,10 +2447,10 @@ vec3d MeshGeom::GetVertex3d( int surf, double x, double p, int r )
 //  buildVertexVec(&sliceVec, 1, vertVec);
 //}
 
-//==== Call After BndBoxes Have Been Create But Before Intersect ====//
-void MeshGeom::MassSliceX( int numSlices )
+//==== Clean Up Meshes, Augment IDs And Load Bnd Boxes - Shared By All Mass Prop Modes ====//
+Results* MeshGeom::InitMassProps()
 {
-    int i, j, s;
+    int i;
 
     //==== Check For Open Meshes and Merge or Delete Them ====//
     MeshInfo info;
@@ -2501,11 +2488,21 @@ void MeshGeom::MassSliceX( int numSlices )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_BndBox );
     }
     m_BBox = b;
     //update_xformed_bbox();            // Load Xform BBox
 
+    return res;
+}
+
+//==== Call After BndBoxes Have Been Create But Before Intersect ====//
+void MeshGeom::MassSliceX( int numSlices )
+{
+    int i, j, s;
+
+    Results* res = InitMassProps();
+
     double xMin = m_BBox.GetMin( 0 );
     double xMax = m_BBox.GetMax( 0 );
 
@@ -2545,66 +2542,259 @@ void MeshGeom::MassSliceX( int numSlices )
         }
     }
 
-    //==== Load Bnding Box ====//
+    //==== Intersect, Split And Classify Slices ====//
+    SliceTMeshes( true );
+    /**********
+        //==== Delete Mesh Geometry ====//
+        for ( i = 0 ; i < (int)tMeshVec.size() ; i++ )
+        {
+            delete tMeshVec[i];
+        }
+        tMeshVec.erase( tMeshVec.begin(), tMeshVec.end() );
+    *********/
+    //==== Intersect All Mesh Geoms ====//
+    IntersectTMeshes();
+
+    //==== Split Intersected Tri in Mesh ====//
+    SplitTMeshes( 0 );
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    DeterIntExtTMeshes();
+
+    //==== Build Tetrahedrons ====//
+    double prismLength = sliceW;
+    vector< TetraMassProp* > tetraVec;
+    m_MinTriDen = 1.0e06;
+    m_MaxTriDen = 0.0;
+
     for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
     {
         TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
         {
-            tm->Intersect( m_TMeshVec[i] );
+            TTri* tri = tm->m_TVec[i];
 
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
+            if ( tri->m_SplitVec.size() )
             {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
                 {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
+                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
+                    {
+                        CreatePrism( tetraVec, tri->m_SplitVec[j], prismLength );
+                    }
                 }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
+            }
+            else if ( tri->m_InteriorFlag == 0 )
+            {
+                CreatePrism( tetraVec, tri, prismLength );
             }
         }
+    }
 
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
+    FinishMassProps( res, tetraVec );
+}
 
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
+//==== Integrals Of 1, x, y, z, xx, yy, zz, xy, xz, yz Over Tetra ( Origin, p0, p1, p2 ) ====//
+static void AddTetraIntegrals( const vec3d & p0, const vec3d & p1, const vec3d & p2, double sign, double* vi )
+{
+    double vol = sign * dot( p0, cross( p1, p2 ) ) / 6.0;
+    vec3d sum = p0 + p1 + p2;
 
+    vi[0] += vol;
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        vi[1 + k] += vol * sum[k] / 4.0;
     }
-    /**********
-        //==== Delete Mesh Geometry ====//
-        for ( i = 0 ; i < (int)tMeshVec.size() ; i++ )
+
+    //==== Int( xi * xj ) = Vol / 20 * ( Sum Of Vertex Products + Product Of Vertex Sums ) ====//
+    const int ind[6][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    for ( int k = 0 ; k < 6 ; k++ )
+    {
+        int a = ind[k][0];
+        int b = ind[k][1];
+        double prod = p0[a] * p0[b] + p1[a] * p1[b] + p2[a] * p2[b] + sum[a] * sum[b];
+        vi[4 + k] += vol * prod / 20.0;
+    }
+}
+
+//==== Mass Props From Signed Tetra-To-Origin Sums Over The Trimmed Surface (Divergence Theorem) ====//
+void MeshGeom::MassSurfIntegral()
+{
+    int i, m, t;
+    const int num_int = 10;
+    const int block_size = 256;
+
+    Results* res = InitMassProps();
+
+    //==== Intersect All Mesh Geoms ====//
+    IntersectTMeshes();
+
+    //==== Split Intersected Tri in Mesh ====//
+    SplitTMeshes( 0 );
+
+    int num_mesh = ( int )m_TMeshVec.size();
+
+    //==== Integrate About Box Center To Limit Round Off ====//
+    vec3d ref = m_BBox.GetCenter();
+
+    //==== Flip Inward Facing Meshes ====//
+    vector< double > orient( num_mesh, 1.0 );
+    for ( m = 0 ; m < num_mesh ; m++ )
+    {
+        double vol = 0.0;
+        for ( t = 0 ; t < ( int )m_TMeshVec[m]->m_TVec.size() ; t++ )
         {
-            delete tMeshVec[i];
+            TTri* tri = m_TMeshVec[m]->m_TVec[t];
+            vol += tetra_volume( tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
         }
-        tMeshVec.erase( tMeshVec.begin(), tMeshVec.end() );
-    *********/
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        if ( vol < 0.0 )
+        {
+            orient[m] = -1.0;
+        }
+    }
+
+    //==== Fixed Blocks Of Tris - Summed In Block Order So Results Do Not Depend On Threads ====//
+    vector< pair< int, int > > blockVec;
+    for ( m = 0 ; m < num_mesh ; m++ )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        for ( t = 0 ; t < ( int )m_TMeshVec[m]->m_TVec.size() ; t += block_size )
         {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            blockVec.push_back( pair< int, int >( m, t ) );
         }
     }
 
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    //==== Per Block: Owner Mesh Index And Its Integrals ====//
+    vector< vector< pair< int, vector< double > > > > blockIntVec( blockVec.size() );
+
+    ThreadUtil::ParallelFor( ( int )blockVec.size(), [&]( int b, int thread_index )
+    {
+        int mesh_ind = blockVec[b].first;
+        TMesh* tm = m_TMeshVec[mesh_ind];
+        int t_end = min( blockVec[b].second + block_size, ( int )tm->m_TVec.size() );
+
+        vector< TTri* > triVec;
+        for ( int bt = blockVec[b].second ; bt < t_end ; bt++ )
+        {
+            TTri* tri = tm->m_TVec[bt];
+            if ( tri->m_SplitVec.size() )
+            {
+                tri->m_InteriorFlag = 1;
+                triVec.insert( triVec.end(), tri->m_SplitVec.begin(), tri->m_SplitVec.end() );
+            }
+            else
+            {
+                triVec.push_back( tri );
+            }
+        }
+
+        for ( int k = 0 ; k < ( int )triVec.size() ; k++ )
+        {
+            TTri* tri = triVec[k];
+
+            //==== Region Just Outside Tri Belongs To Out Owner, Just Inside To In Owner ====//
+            int out_owner = tm->FindMassOwner( tri, m_TMeshVec );
+            tri->m_InteriorFlag = ( out_owner >= 0 );
+
+            int in_owner = out_owner;
+            int out_prior = ( out_owner >= 0 ) ? m_TMeshVec[out_owner]->m_MassPrior : -1;
+            if ( tm->m_MassPrior > out_prior || ( tm->m_MassPrior == out_prior && mesh_ind < out_owner ) )
+            {
+                in_owner = mesh_ind;
+            }
+
+            if ( in_owner == out_owner )
+            {
+                continue;
+            }
+
+            vec3d p0 = tri->m_N0->m_Pnt - ref;
+            vec3d p1 = tri->m_N1->m_Pnt - ref;
+            vec3d p2 = tri->m_N2->m_Pnt - ref;
+
+            int owner[2] = { in_owner, out_owner };
+            double sign[2] = { orient[mesh_ind], -orient[mesh_ind] };
+            for ( int o = 0 ; o < 2 ; o++ )
+            {
+                if ( owner[o] < 0 )
+                {
+                    continue;
+                }
+
+                vector< pair< int, vector< double > > > & intVec = blockIntVec[b];
+                int ind = 0;
+                while ( ind < ( int )intVec.size() && intVec[ind].first != owner[o] )
+                {
+                    ind++;
+                }
+                if ( ind == ( int )intVec.size() )
+                {
+                    intVec.push_back( pair< int, vector< double > >( owner[o], vector< double >( num_int, 0.0 ) ) );
+                }
+                AddTetraIntegrals( p0, p1, p2, sign[o], &intVec[ind].second[0] );
+            }
+        }
+    } );
+
+    vector< vector< double > > meshIntVec( num_mesh, vector< double >( num_int, 0.0 ) );
+    for ( int b = 0 ; b < ( int )blockIntVec.size() ; b++ )
     {
-        m_TMeshVec[i]->Split();
+        for ( i = 0 ; i < ( int )blockIntVec[b].size() ; i++ )
+        {
+            vector< double > & vi = meshIntVec[ blockIntVec[b][i].first ];
+            for ( int k = 0 ; k < num_int ; k++ )
+            {
+                vi[k] += blockIntVec[b][i].second[k];
+            }
+        }
     }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    //==== One Mass Prop Per Component - Inertia About Its Own CG ====//
+    vector< TetraMassProp* > tetraVec;
+    m_MinTriDen = 1.0e06;
+    m_MaxTriDen = 0.0;
+
+    for ( m = 0 ; m < num_mesh ; m++ )
     {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        vector< double > & vi = meshIntVec[m];
+        if ( vi[0] <= 0.0 )
+        {
+            continue;
+        }
+
+        TMesh* tm = m_TMeshVec[m];
+        double den = tm->m_Density;
+        m_MinTriDen = min( m_MinTriDen, den );
+        m_MaxTriDen = max( m_MaxTriDen, den );
+
+        vec3d cg( vi[1] / vi[0], vi[2] / vi[0], vi[3] / vi[0] );
+
+        TetraMassProp* tmp = new TetraMassProp();
+        tmp->m_CompId = tm->m_PtrID;
+        tmp->m_PointMassFlag = false;
+        tmp->m_Density = den;
+        tmp->m_Vol = vi[0];
+        tmp->m_Mass = den * vi[0];
+        tmp->m_CG = cg + ref;
+
+        double mass = tmp->m_Mass;
+        tmp->m_Ixx = den * ( vi[5] + vi[6] ) - mass * ( cg.y() * cg.y() + cg.z() * cg.z() );
+        tmp->m_Iyy = den * ( vi[4] + vi[6] ) - mass * ( cg.x() * cg.x() + cg.z() * cg.z() );
+        tmp->m_Izz = den * ( vi[4] + vi[5] ) - mass * ( cg.x() * cg.x() + cg.y() * cg.y() );
+        tmp->m_Ixy = den * vi[7] - mass * cg.x() * cg.y();
+        tmp->m_Ixz = den * vi[8] - mass * cg.x() * cg.z();
+        tmp->m_Iyz = den * vi[9] - mass * cg.y() * cg.z();
+
+        tetraVec.push_back( tmp );
     }
 
+    FinishMassProps( res, tetraVec );
+}
+
+//==== Add Shells And Point Masses To Volume Mass Props, Sum Totals And Write Results ====//
+void MeshGeom::FinishMassProps( Results* res, vector< TetraMassProp* > & tetraVec )
+{
+    int i, j, s;
+
     //==== Do Shell Calcs ====//
     vector< TriShellMassProp* > triShellVec;
     for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
@@ -2639,36 +2829,6 @@ void MeshGeom::MassSliceX( int numSlices )
         }
     }
 
-    //==== Build Tetrahedrons ====//
-    double prismLength = sliceW;
-    vector< TetraMassProp* > tetraVec;
-    m_MinTriDen = 1.0e06;
-    m_MaxTriDen = 0.0;
-
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
-        {
-            TTri* tri = tm->m_TVec[i];
-
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
-                    {
-                        CreatePrism( tetraVec, tri->m_SplitVec[j], prismLength );
-                    }
-                }
-            }
-            else if ( tri->m_InteriorFlag == 0 )
-            {
-                CreatePrism( tetraVec, tri, prismLength );
-            }
-        }
-    }
-
     //==== Add in Point Masses ====//
     for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
     {
@@ -2906,21 +3066,18 @@ void MeshGeom::MassSliceX( int numSlices )
     res->WriteMassProp( f_name );
 }
 
+//==== Call After degenGeomIntersectTrim - Reuses Its Merged, Intersected And Split Meshes ====//
 void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 {
     int i, j, s, numSlices = 250;
 
-    //==== Check For Open Meshes and Merge or Delete Them ====//
-    MeshInfo info;
-    MergeRemoveOpenMeshes( &info );
-
     //==== Augment ID with index to make symmetric copies unique. ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
         m_TMeshVec[i]->m_PtrID.append( std::to_string( (long long) i ) );
     }
 
-    //==== Create Bnd Box for  Mesh Geoms ====//
+    //==== Rebuild Bnd Box for Mesh Geoms - Trim Was Done At A Different Scale ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
         m_TMeshVec[i]->LoadBndBox();
@@ -2930,7 +3087,7 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
     BndBox b;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        b.Update( m_TMeshVec[i]->m_TBox.m_Box );
+        b.Update( m_TMeshVec[i]->m_BndBox );
     }
     m_BBox = b;
     //update_xformed_bbox();          // Load Xform BBox
@@ -2970,58 +3127,8 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         }
     }
 
-    //==== Load Bounding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
-    {
-        TMesh* tm = m_SliceVec[s];
-        tm->LoadBndBox();
-
-        //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
-
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
-
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
-    }
-
-
-    //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
-
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->Split();
-    }
-
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    //==== Intersect, Split And Classify Slices ====//
+    SliceTMeshes( true );
 
     //==== Do Shell Calcs ====//
     vector< DegenGeomTriShellMassProp* > triShellVec;
@@ -3203,7 +3310,7 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
     for ( i = 0, j = 0; i < ( int )degenGeom.size(); i++, j++ )
     {
         matchFlag = false;
-        DegenPoint degenPoint = degenGeom[i].getDegenPoint();
+        DegenPoint & degenPoint = degenGeom[i].getDegenPoint();
 
         // Loop through tmesh vector
         for ( j = 0; j < m_TMeshVec.size(); j++ )
@@ -3231,8 +3338,6 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
             degenPoint.xcgSolid.push_back( vec3d( NAN, NAN, NAN ) );
             degenPoint.xcgShell.push_back( vec3d( NAN, NAN, NAN ) );
         }
-
-        degenGeom[i].setDegenPoint( degenPoint );
     }
 
     //==== Clean Up Mess ====//
@@ -146,6 +146,7 @@ public:
     virtual void degenGeomIntersectTrim( vector< DegenGeom > &degenGeom );
     virtual void SliceX( int numSlice );
     virtual void MassSliceX( int numSlice );
+    virtual void MassSurfIntegral();
     virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
     virtual void AreaSlice( int style, int numSlices, double sliceAngle, double coneSections, vec3d norm, bool autoBounds,
                             double start = 0, double end = 0 );
@@ -154,9 +155,17 @@ public:
 
     virtual void MergeRemoveOpenMeshes( MeshInfo* info );
 
+    //==== Intersect, Split And Classify Stages Over m_TMeshVec (Run Concurrently) ====//
+    virtual void IntersectTMeshes();
+    virtual void SplitTMeshes( int meshFlag );
+    virtual void DeterIntExtTMeshes();
+    virtual void SliceTMeshes( bool massFlag );
+
     virtual vec3d GetVertex3d( int surf, double x, double p, int r );
     //virtual void  getVertexVec(vector< VertexID > *vertVec);
 
+    virtual Results* InitMassProps();
+    virtual void FinishMassProps( Results* res, vector< TetraMassProp* > & tetraVec );
     virtual void CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len );
     virtual void createDegenGeomPrism( vector< DegenGeomTetraMassProp* >& tetraVec, TTri* tri, double len );
 
@@ -179,6 +179,13 @@ double Parm::SetFromLink( double val )
 
     LinkMgr.ParmChanged( m_ID, false );
 
+    //==== Links Driven By A Deferred Edit - Container Update Waits For Commit ====//
+    if ( ParmMgr.GetTransactionLinkFlag() )
+    {
+        ParmMgr.AddToTransaction( this, false );
+        return m_Val;
+    }
+
     if ( m_Container )
     {
         m_Container->ParmChanged( this, SET_FROM_LINK );
@@ -197,6 +204,13 @@ double Parm::SetFromDevice( double val )
 
     ParmMgr.AddToUndoStack( this );
 
+    //==== Container And Link Updates Wait For Transaction Commit ====//
+    if ( ParmMgr.GetTransactionDepth() > 0 )
+    {
+        ParmMgr.AddToTransaction( this, true );
+        return m_Val;
+    }
+
     if ( m_Container )
     {
         m_Container->ParmChanged( this,  SET_FROM_DEVICE );
@@ -521,6 +535,13 @@ double FractionParm::SetFromLink( double val )
 
     LinkMgr.ParmChanged( m_ID, false );
 
+    //==== Links Driven By A Deferred Edit - Container Update Waits For Commit ====//
+    if ( ParmMgr.GetTransactionLinkFlag() )
+    {
+        ParmMgr.AddToTransaction( this, false );
+        return m_Val;
+    }
+
     if ( m_Container )
     {
         m_Container->ParmChanged( this, SET_FROM_LINK );
@@ -542,6 +563,13 @@ double FractionParm::SetFromDevice( double val )
 
     UpdateResultVal();
 
+    //==== Container And Link Updates Wait For Transaction Commit ====//
+    if ( ParmMgr.GetTransactionDepth() > 0 )
+    {
+        ParmMgr.AddToTransaction( this, true );
+        return m_Val;
+    }
+
     if ( m_Container )
     {
         m_Container->ParmChanged( this,  SET_FROM_DEVICE );
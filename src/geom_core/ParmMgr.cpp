@@ -23,6 +23,8 @@ using std::unordered_map;
 ParmMgrSingleton::ParmMgrSingleton()
 {
     m_NumParmChanges = 0;
+    m_TransactionDepth = 0;
+    m_TransactionLinkFlag = false;
 //  m_UpdateParmVecFlag = false;
 
 }
@@ -161,6 +163,61 @@ void ParmMgrSingleton::UnDo()
     }
 }
 
+//==== Record Parm Set During Transaction - Link Flag Queues Its Links ====//
+void ParmMgrSingleton::AddToTransaction( Parm* parm_ptr, bool link_flag )
+{
+    string id = parm_ptr->GetID();
+    unordered_map< string, bool >::iterator iter = m_TransactionParmMap.find( id );
+
+    if ( iter == m_TransactionParmMap.end() )
+    {
+        m_TransactionParmVec.push_back( id );
+        iter = m_TransactionParmMap.insert( make_pair( id, false ) ).first;
+    }
+
+    if ( link_flag && !iter->second )
+    {
+        iter->second = true;
+        m_TransactionLinkQueue.push_back( id );
+    }
+}
+
+//==== Next Changed Parm Whose Links Have Not Been Propagated ====//
+bool ParmMgrSingleton::PopTransactionLinkParm( string & id )
+{
+    if ( m_TransactionLinkQueue.empty() )
+    {
+        return false;
+    }
+
+    id = m_TransactionLinkQueue.front();
+    m_TransactionLinkQueue.pop_front();
+    m_TransactionParmMap[ id ] = false;
+    return true;
+}
+
+//==== Close Transaction - Outermost Returns All Changed Parms ====//
+void ParmMgrSingleton::EndTransaction( vector< string > & changed_parm_vec )
+{
+    changed_parm_vec.clear();
+
+    if ( m_TransactionDepth == 0 )
+    {
+        return;
+    }
+
+    m_TransactionDepth--;
+    if ( m_TransactionDepth > 0 )
+    {
+        return;
+    }
+
+    changed_parm_vec.swap( m_TransactionParmVec );
+    m_TransactionParmVec.clear();
+    m_TransactionParmMap.clear();
+    m_TransactionLinkQueue.clear();
+}
+
 //==== Create A Unique ID  =====//
 string ParmMgrSingleton::GenerateID( int length )
 {
@@ -19,6 +19,7 @@
 #include <map>
 #include <unordered_map>
 #include <stack>
+#include <deque>
 
 using std::string;
 using std::unordered_map;
@@ -43,6 +44,13 @@ private:
 
     int m_NumParmChanges;
 
+    //==== Parm Transaction ====//
+    int m_TransactionDepth;
+    bool m_TransactionLinkFlag;                                     // Commit Is Propagating Deferred Links
+    vector< string > m_TransactionParmVec;                          // Changed Parms, In Order, Once Each
+    unordered_map< string, bool > m_TransactionParmMap;             // Changed Parm ID->Links Pending
+    std::deque< string > m_TransactionLinkQueue;                    // Changed Parms Whose Links Are Pending
+
 public:
     static ParmMgrSingleton& getInstance()
     {
@@ -73,6 +81,15 @@ public:
 
     Parm* CreateParm( int type );
 
+    //==== Parm Transactions - Device Sets While Open Defer Container And Link Updates ====//
+    void BeginTransaction()                 { m_TransactionDepth++; }
+    int GetTransactionDepth()               { return m_TransactionDepth; }
+    void SetTransactionLinkFlag( bool f )   { m_TransactionLinkFlag = f; }
+    bool GetTransactionLinkFlag()           { return m_TransactionLinkFlag; }
+    void AddToTransaction( Parm* parm_ptr, bool link_flag );
+    bool PopTransactionLinkParm( string & id );
+    void EndTransaction( vector< string > & changed_parm_vec );
+
     //=== Get Container, Group and Parm Name Given Parm ID ====//
     void GetNames( const string& parm_id, string& container_name, string& group_name, string& parm_name );
 };
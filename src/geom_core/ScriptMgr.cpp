@@ -23,6 +23,12 @@
 #include "StringUtil.h"
 #include "FileUtil.h"
 
+#ifdef WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
 using namespace vsp;
 
 //==== Implement a simple message callback function ====//
@@ -40,6 +46,75 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
     printf( "%s (%d, %d) : %s : %s\n", msg->section, msg->row, msg->col, type, msg->message );
 }
 
+//==== FNV-1a Hash - Running Value Passed In So Pieces Can Be Chained ====//
+static const asQWORD HASH_START = 0xcbf29ce484222325ULL;
+
+static asQWORD HashBytes( const void* data, size_t size, asQWORD hash = HASH_START )
+{
+    const unsigned char* bytes = ( const unsigned char* )data;
+    for ( size_t i = 0 ; i < size ; i++ )
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static asQWORD HashString( const char* str, asQWORD hash = HASH_START )
+{
+    if ( !str )
+    {
+        str = "";
+    }
+    return HashBytes( str, strlen( str ) + 1, hash );          // Include Terminator As Separator
+}
+
+//==== In Memory Byte Code Stream - Reads Past End Return Zeros And Set Flag ====//
+class ByteCodeStream : public asIBinaryStream
+{
+public:
+    ByteCodeStream()
+    {
+        m_ReadPos = 0;
+        m_ReadError = false;
+    }
+
+    virtual void Read( void *ptr, asUINT size )
+    {
+        if ( m_ReadPos + size > m_Buffer.size() )
+        {
+            memset( ptr, 0, size );
+            m_ReadPos = m_Buffer.size();
+            m_ReadError = true;
+            return;
+        }
+        memcpy( ptr, &m_Buffer[m_ReadPos], size );
+        m_ReadPos += size;
+    }
+    virtual void Write( const void *ptr, asUINT size )
+    {
+        const char* bytes = ( const char* )ptr;
+        m_Buffer.insert( m_Buffer.end(), bytes, bytes + size );
+    }
+
+    vector< char > m_Buffer;
+    size_t m_ReadPos;
+    bool m_ReadError;
+};
+
+//==== Byte Code File Header ====//
+struct ByteCodeHeader
+{
+    char m_Magic[8];
+    asQWORD m_EngineSignature;
+    asQWORD m_ContentHash;
+    asQWORD m_ContentSize;
+    asQWORD m_ByteCodeHash;
+    asQWORD m_ByteCodeSize;
+};
+
+static const char BYTE_CODE_MAGIC[8] = { 'V', 'S', 'P', 'A', 'S', 'B', 'C', '1' };
+
 //==================================================================================================//
 //========================================= ScriptMgr      =========================================//
 //==================================================================================================//
@@ -48,7 +123,8 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
 //==== Constructor ====//
 ScriptMgrSingleton::ScriptMgrSingleton()
 {
-
+    m_EngineSignatureValid = false;
+    m_EngineSignature = 0;
 }
 
 //==== Set Up Script Engine, Script Error Callbacks ====//
@@ -131,7 +207,7 @@ vector< string > ScriptMgrSingleton::ReadScriptsFromDir( const string & dir_name
             string sub = file_vec[i].substr( 0, file_vec[i].size() - 3 );
             string file_name = dir_name;
             file_name.append( file_vec[i] );
-            string module_name = ScriptMgr.ReadScriptFromFile( sub, file_name );
+            string module_name = ScriptMgr.ReadScriptFromFile( sub, file_name, file_name + "bc" );
 
             if ( module_name.size() )
                 mod_name_vec.push_back( module_name );
@@ -142,7 +218,8 @@ vector< string > ScriptMgrSingleton::ReadScriptsFromDir( const string & dir_name
 }
 
 //==== Start A New Module And Read Script ====//
-string ScriptMgrSingleton::ReadScriptFromFile( const string & module_name, const string &  file_name )
+string ScriptMgrSingleton::ReadScriptFromFile( const string & module_name, const string &  file_name,
+                                               const string & byte_code_file_name )
 {
     string content = ExtractContent( file_name );
 
@@ -151,11 +228,12 @@ string ScriptMgrSingleton::ReadScriptFromFile( const string & module_name, const
         return string();
     }
 
-    return ReadScriptFromMemory( module_name, content );
+    return ReadScriptFromMemory( module_name, content, byte_code_file_name );
 }
 
 //==== Start A New Module And Read Script ====//
-string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, const string & script_content )
+string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, const string & script_content,
+                                                 const string & byte_code_file_name )
 {
     int r;
     string updated_module_name = module_name;
@@ -182,7 +260,16 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
             return iter->first;
     }
 
-    //==== Start A New Module ====//
+    //==== Start A New Module - Discards Any Old Module And Its Functions ====//
+    m_FunctionCacheMap.erase( updated_module_name );
+
+    //==== Restore Compiled Module If Cached Byte Code Matches ====//
+    if ( byte_code_file_name.size() && LoadByteCode( updated_module_name, script_content, byte_code_file_name ) )
+    {
+        m_ModuleContentMap[ updated_module_name ] = script_content;
+        return updated_module_name;
+    }
+
     r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
     if( r < 0 )        return string();
 
@@ -192,6 +279,11 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
     r = m_ScriptBuilder.BuildModule();
     if ( r < 0 )    return string();
 
+    if ( byte_code_file_name.size() )
+    {
+        SaveByteCode( updated_module_name, script_content, byte_code_file_name );
+    }
+
     //==== Add To Map ====//
     m_ModuleContentMap[ updated_module_name ] = script_content;
 
@@ -217,28 +309,214 @@ string ScriptMgrSingleton::ExtractContent( const string & file_name )
 }
 
 
-//==== Execute Function in Module ====//
-void ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* function_name )
+//==== Load Module From Byte Code File - False If Missing Or Stale ====//
+bool ScriptMgrSingleton::LoadByteCode( const string & module_name, const string & script_content,
+                                       const string & byte_code_file_name )
 {
-    int r;
+    FILE* fp = fopen( byte_code_file_name.c_str(), "rb" );
+    if ( !fp )
+    {
+        return false;
+    }
 
-    // Find the function that is to be called.
-    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name );
+    //==== Check Key - Script Content And Engine Registration Must Both Match ====//
+    ByteCodeHeader header;
+    bool valid = ( fread( &header, sizeof( header ), 1, fp ) == 1 );
+    valid = valid && memcmp( header.m_Magic, BYTE_CODE_MAGIC, sizeof( BYTE_CODE_MAGIC ) ) == 0;
+    valid = valid && header.m_EngineSignature == GetEngineSignature();
+    valid = valid && header.m_ContentSize == ( asQWORD )script_content.size();
+    valid = valid && header.m_ContentHash == HashBytes( script_content.data(), script_content.size() );
+
+    ByteCodeStream stream;
+    if ( valid )
+    {
+        stream.m_Buffer.resize( ( size_t )header.m_ByteCodeSize );
+        if ( stream.m_Buffer.size() )
+        {
+            valid = ( fread( &stream.m_Buffer[0], stream.m_Buffer.size(), 1, fp ) == 1 );
+        }
+        valid = valid && header.m_ByteCodeHash == HashBytes( stream.m_Buffer.data(), stream.m_Buffer.size() );
+    }
+    fclose( fp );
+
+    if ( !valid )
+    {
+        return false;
+    }
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str(), asGM_ALWAYS_CREATE );
+    if ( !mod )
+    {
+        return false;
+    }
 
+    int r = mod->LoadByteCode( &stream );
+    if ( r < 0 || stream.m_ReadError )
+    {
+        mod->Discard();
+        return false;
+    }
+    return true;
+}
+
+//==== Write Compiled Module To Byte Code File - Failures Are Ignored ====//
+void ScriptMgrSingleton::SaveByteCode( const string & module_name, const string & script_content,
+                                       const string & byte_code_file_name )
+{
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str() );
     if ( !mod )
     {
-        printf( "Error ExecuteScript GetModule %s\n", module_name );
         return;
     }
 
-    asIScriptFunction *func = mod->GetFunctionByDecl( function_name );
+    ByteCodeStream stream;
+    if ( mod->SaveByteCode( &stream ) < 0 )
+    {
+        return;
+    }
+
+    ByteCodeHeader header;
+    memcpy( header.m_Magic, BYTE_CODE_MAGIC, sizeof( BYTE_CODE_MAGIC ) );
+    header.m_EngineSignature = GetEngineSignature();
+    header.m_ContentSize = ( asQWORD )script_content.size();
+    header.m_ContentHash = HashBytes( script_content.data(), script_content.size() );
+    header.m_ByteCodeSize = ( asQWORD )stream.m_Buffer.size();
+    header.m_ByteCodeHash = HashBytes( stream.m_Buffer.data(), stream.m_Buffer.size() );
+
+    //==== Write Temp File Then Rename - Readers Never See A Partial File ====//
+    //==== Temp Name Is Per Process So Concurrent Writers Do Not Collide ====//
+#ifdef WIN32
+    int pid = _getpid();
+#else
+    int pid = ( int )getpid();
+#endif
+    string tmp_file_name = byte_code_file_name + "." + StringUtil::int_to_string( pid, "%d" ) + ".tmp";
+    FILE* fp = fopen( tmp_file_name.c_str(), "wb" );
+    if ( !fp )
+    {
+        return;
+    }
+
+    bool valid = ( fwrite( &header, sizeof( header ), 1, fp ) == 1 );
+    if ( valid && stream.m_Buffer.size() )
+    {
+        valid = ( fwrite( &stream.m_Buffer[0], stream.m_Buffer.size(), 1, fp ) == 1 );
+    }
+    valid = ( fclose( fp ) == 0 ) && valid;
+
+    if ( valid )
+    {
+#ifdef WIN32
+        //==== Windows Rename Does Not Replace An Existing File ====//
+        remove( byte_code_file_name.c_str() );
+#endif
+        valid = ( rename( tmp_file_name.c_str(), byte_code_file_name.c_str() ) == 0 );
+    }
+    if ( !valid )
+    {
+        remove( tmp_file_name.c_str() );
+    }
+}
+
+//==== Hash Of Engine Version And All Registered Declarations ====//
+// Byte code refers to registered functions and types, so any change to the
+// registered API must invalidate previously saved byte code.
+asQWORD ScriptMgrSingleton::GetEngineSignature()
+{
+    if ( m_EngineSignatureValid )
+    {
+        return m_EngineSignature;
+    }
+
+    asIScriptEngine* se = m_ScriptEngine;
+    asQWORD hash = HashString( ANGELSCRIPT_VERSION_STRING );
+
+    int ptr_size = ( int )sizeof( void* );
+    hash = HashBytes( &ptr_size, sizeof( ptr_size ), hash );
+
+    for ( asUINT i = 0 ; i < se->GetGlobalFunctionCount() ; i++ )
+    {
+        hash = HashString( se->GetGlobalFunctionByIndex( i )->GetDeclaration( true, true ), hash );
+    }
+
+    for ( asUINT i = 0 ; i < se->GetGlobalPropertyCount() ; i++ )
+    {
+        const char* name = 0;
+        const char* name_space = 0;
+        int type_id = 0;
+        se->GetGlobalPropertyByIndex( i, &name, &name_space, &type_id );
+        hash = HashString( name_space, HashString( name, hash ) );
+        hash = HashString( se->GetTypeDeclaration( type_id, true ), hash );
+    }
+
+    for ( asUINT i = 0 ; i < se->GetObjectTypeCount() ; i++ )
+    {
+        asIObjectType* type = se->GetObjectTypeByIndex( i );
+        hash = HashString( type->GetName(), hash );
+        for ( asUINT m = 0 ; m < type->GetFactoryCount() ; m++ )
+        {
+            hash = HashString( type->GetFactoryByIndex( m )->GetDeclaration( true, true ), hash );
+        }
+        for ( asUINT m = 0 ; m < type->GetBehaviourCount() ; m++ )
+        {
+            asEBehaviours beh;
+            asIScriptFunction* func = type->GetBehaviourByIndex( m, &beh );
+            hash = HashBytes( &beh, sizeof( beh ), hash );
+            hash = HashString( func ? func->GetDeclaration( true, true ) : "", hash );
+        }
+        for ( asUINT m = 0 ; m < type->GetMethodCount() ; m++ )
+        {
+            hash = HashString( type->GetMethodByIndex( m )->GetDeclaration( true, true ), hash );
+        }
+        for ( asUINT p = 0 ; p < type->GetPropertyCount() ; p++ )
+        {
+            hash = HashString( type->GetPropertyDeclaration( p, true ), hash );
+        }
+    }
+
+    for ( asUINT i = 0 ; i < se->GetEnumCount() ; i++ )
+    {
+        int type_id = 0;
+        hash = HashString( se->GetEnumByIndex( i, &type_id ), hash );
+        for ( int v = 0 ; v < se->GetEnumValueCount( type_id ) ; v++ )
+        {
+            int val = 0;
+            hash = HashString( se->GetEnumValueByIndex( type_id, v, &val ), hash );
+            hash = HashBytes( &val, sizeof( val ), hash );
+        }
+    }
+
+    for ( asUINT i = 0 ; i < se->GetFuncdefCount() ; i++ )
+    {
+        hash = HashString( se->GetFuncdefByIndex( i )->GetDeclaration( true, true ), hash );
+    }
+
+    for ( asUINT i = 0 ; i < se->GetTypedefCount() ; i++ )
+    {
+        int type_id = 0;
+        hash = HashString( se->GetTypedefByIndex( i, &type_id ), hash );
+        hash = HashString( se->GetTypeDeclaration( type_id, true ), hash );
+    }
+
+    m_EngineSignature = hash;
+    m_EngineSignatureValid = true;
+    return m_EngineSignature;
+}
+
+//==== Execute Function in Module ====//
+void ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* function_name )
+{
+    int r;
+
+    // Find the function that is to be called.
+    asIScriptFunction *func = FindFunction( module_name, function_name );
     if( func == 0 )
     {
         return;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
+    // Take a pooled context, prepare it, and then execute
+    asIScriptContext *ctx = RequestContext();
     ctx->Prepare( func );
     r = ctx->Execute();
     if( r != asEXECUTION_FINISHED )
@@ -250,6 +528,49 @@ void ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
             printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
         }
     }
+    ReturnContext( ctx );
+}
+
+//==== Find Function In Module - Decl Is Parsed Only On First Call ====//
+asIScriptFunction* ScriptMgrSingleton::FindFunction( const string & module_name, const string & function_name )
+{
+    map< string, asIScriptFunction* > & func_map = m_FunctionCacheMap[ module_name ];
+    map< string, asIScriptFunction* >::iterator iter = func_map.find( function_name );
+    if ( iter != func_map.end() )
+    {
+        return iter->second;
+    }
+
+    asIScriptModule *mod = m_ScriptEngine->GetModule( module_name.c_str() );
+    if ( !mod )
+    {
+        printf( "Error ExecuteScript GetModule %s\n", module_name.c_str() );
+        m_FunctionCacheMap.erase( module_name );
+        return NULL;
+    }
+
+    asIScriptFunction *func = mod->GetFunctionByDecl( function_name.c_str() );
+    func_map[ function_name ] = func;
+    return func;
+}
+
+//==== Get Unused Context From Pool Or Create New One ====//
+asIScriptContext* ScriptMgrSingleton::RequestContext()
+{
+    if ( m_ContextPool.size() )
+    {
+        asIScriptContext* ctx = m_ContextPool.back();
+        m_ContextPool.pop_back();
+        return ctx;
+    }
+    return m_ScriptEngine->CreateContext();
+}
+
+//==== Release Objects Held By Context And Put Back In Pool ====//
+void ScriptMgrSingleton::ReturnContext( asIScriptContext* ctx )
+{
+    ctx->Unprepare();
+    m_ContextPool.push_back( ctx );
 }
 
 //==== Return Script Content Given Module Name ====//
@@ -442,6 +763,13 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     r = se->RegisterEnumValue( "SET_TYPE", "SET_FIRST_USER", SET_FIRST_USER );
     assert( r >= 0 );
 
+    r = se->RegisterEnum( "MASS_PROP_MODE" );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "MASS_PROP_MODE", "MASS_PROP_SLICE", MASS_PROP_SLICE );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "MASS_PROP_MODE", "MASS_PROP_SURF_INTEGRAL", MASS_PROP_SURF_INTEGRAL );
+    assert( r >= 0 );
+
     r = se->RegisterEnum( "IMPORT_TYPE" );
     assert( r >= 0 );
     r = se->RegisterEnumValue( "IMPORT_TYPE", "IMPORT_STL", IMPORT_STL );
@@ -817,7 +1145,7 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     //==== Computations ====//
     r = se->RegisterGlobalFunction( "void SetComputationFileName( int file_type, const string & in file_name )", asFUNCTION( vsp::SetComputationFileName ), asCALL_CDECL );
     assert( r >= 0 );
-    r = se->RegisterGlobalFunction( "string ComputeMassProps( int set, int num_slices )", asFUNCTION( vsp::ComputeMassProps ), asCALL_CDECL );
+    r = se->RegisterGlobalFunction( "string ComputeMassProps( int set, int num_slices, int mode = MASS_PROP_SLICE )", asFUNCTION( vsp::ComputeMassProps ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "string ComputeCompGeom( int set, bool half_mesh, int file_export_types )", asFUNCTION( vsp::ComputeCompGeom ), asCALL_CDECL );
     assert( r >= 0 );
@@ -982,6 +1310,10 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     r = se->RegisterGlobalFunction( "double SetParmValUpdate(const string & in geom_id, const string & in name, const string & in group, double val )",
                                     asFUNCTIONPR( vsp::SetParmValUpdate, ( const string &, const string &, const string &, double val ), double ), asCALL_CDECL );
     assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void BeginParmTransaction()", asFUNCTION( vsp::BeginParmTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
+    r = se->RegisterGlobalFunction( "void CommitParmTransaction()", asFUNCTION( vsp::CommitParmTransaction ), asCALL_CDECL );
+    assert( r >= 0 );
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in parm_id )", asFUNCTIONPR( vsp::GetParmVal, ( const string & ), double ), asCALL_CDECL );
     assert( r >= 0 );
     r = se->RegisterGlobalFunction( "double GetParmVal(const string & in geom_id, const string & in name, const string & in group )",
@@ -46,18 +46,25 @@ public:
     void ReadExecuteScriptFile( const string &  file_name, const string &  function_name = "void main()" );
 
     //==== Read Script From File - Return Module Name ====//
-    string ReadScriptFromFile( const string & module_name, const string &  file_name );
+    //==== Byte Code File Is Loaded Instead Of Compiling When It Matches The Script ====//
+    string ReadScriptFromFile( const string & module_name, const string &  file_name,
+                               const string & byte_code_file_name = string() );
 
     //==== Read All Scripts In Dir and Return Module Names ====//
     vector< string > ReadScriptsFromDir( const string & dir_name );
 
     //==== Read Script From Memory - Return Module Name ====//
-    string ReadScriptFromMemory( const string &  module_name, const string & script_content );
+    string ReadScriptFromMemory( const string &  module_name, const string & script_content,
+                                 const string & byte_code_file_name = string() );
 
 
     void ExecuteScript(  const char* module_name,  const char* function_name );
 
     string FindModuleContent( const string & module_name );
+
+    //==== Byte Code Cache - Load Fails If File Is Missing, Stale Or Damaged ====//
+    bool LoadByteCode( const string & module_name, const string & script_content, const string & byte_code_file_name );
+    void SaveByteCode( const string & module_name, const string & script_content, const string & byte_code_file_name );
     int SaveScriptContentToFile( const string & module_name, const string & file_name );
 
     void RunTestScripts();
@@ -103,12 +110,23 @@ private:
     void RegisterAPI( asIScriptEngine* se );
     void RegisterUtility( asIScriptEngine* se );
 
+    //==== Resolve Function By Decl - Cached Per Module ====//
+    asIScriptFunction* FindFunction( const string & module_name, const string & function_name );
+
+    //==== Reuse Contexts Across Executions - Nested Calls Take Another One ====//
+    asIScriptContext* RequestContext();
+    void ReturnContext( asIScriptContext* ctx );
+
     //==== Member Variables ====//
     asIScriptEngine* m_ScriptEngine;
 //    map< string, CScriptBuilder > m_BuilderMap;
     CScriptBuilder m_ScriptBuilder;
     map< string, string > m_ModuleContentMap;
 
+    //==== Module Name -> Function Decl -> Function, Cleared When Module Is Rebuilt ====//
+    map< string, map< string, asIScriptFunction* > > m_FunctionCacheMap;
+    vector< asIScriptContext* > m_ContextPool;
+
     //==== Test Proxy Stuff ====//
     int m_SaveInt;
     vector< vec3d > m_ProxyVec3dArray;
@@ -136,6 +154,11 @@ private:
 
     string ExtractContent( const string & file_name );
 
+    asQWORD GetEngineSignature();
+
+    bool m_EngineSignatureValid;
+    asQWORD m_EngineSignature;              // Hash Of Everything Registered With Engine
+
 
 };
 
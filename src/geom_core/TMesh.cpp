@@ -726,7 +726,145 @@ void TMesh::MergeNonClosed( TMesh* tm )
 
 void TMesh::Intersect( TMesh* tm, bool UWFlag )
 {
-    m_TBox.Intersect( &tm->m_TBox, UWFlag );
+    vector< pair< int, int > > leafPairVec;
+    m_TriBVH.AddOverlapLeafPairs( tm->m_TriBVH, leafPairVec );
+
+    for ( int i = 0 ; i < ( int )leafPairVec.size() ; i++ )
+    {
+        TTri* const* tris0;
+        TTri* const* tris1;
+        int num0 = m_TriBVH.GetLeafTris( leafPairVec[i].first, tris0 );
+        int num1 = tm->m_TriBVH.GetLeafTris( leafPairVec[i].second, tris1 );
+
+        for ( int j = 0 ; j < num0 ; j++ )
+        {
+            for ( int k = 0 ; k < num1 ; k++ )
+            {
+                IntersectTris( tris0[j], tris1[k], UWFlag );
+            }
+        }
+    }
+}
+
+void TMesh::IntersectTris( TTri* t0, TTri* t1, bool UWFlag )
+{
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    int iflag = tri_tri_intersect_with_isectline(
+                    t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                    t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                    &coplanarFlag, e0.v, e1.v );
+
+    if ( iflag && !coplanarFlag )
+    {
+        if ( UWFlag )
+        {
+            if ( dist( e0, e1 ) > 0.000001 )
+            {
+                // Figure out with tri has xyz info
+                TTri* tri;
+                int d_info = TNode::HAS_XYZ; // desired info number
+                if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                        && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
+                {
+                    tri = t0;
+                }
+                else
+                {
+                    tri = t1;
+                }
+                // Use Bilinear interpolation to convert edge uw points to xyz points
+                vec3d e0xyz = tri->CompPnt( e0 );
+                vec3d e1xyz = tri->CompPnt( e1 );
+
+                // Create the new edges
+
+                TEdge* ie0 = new TEdge();
+                int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                ie0->m_N0 = new TNode();
+                ie0->m_N0->SetUWPnt( e0 );
+                ie0->m_N0->SetXYZPnt( e0xyz );
+                ie0->m_N0->MakePntUW();
+                ie0->m_N0->SetCoordInfo( info );
+                ie0->m_N1 = new TNode();
+                ie0->m_N1->SetUWPnt( e1 );
+                ie0->m_N1->SetXYZPnt( e1xyz );
+                ie0->m_N1->MakePntUW();
+                ie0->m_N1->SetCoordInfo( info );
+
+                TEdge* ie1 = new TEdge();
+                ie1->m_N0 = new TNode();
+                ie1->m_N0->SetUWPnt( e0 );
+                ie1->m_N0->SetXYZPnt( e0xyz );
+                ie1->m_N0->MakePntUW();
+                ie1->m_N0->SetCoordInfo( info );
+                ie1->m_N1 = new TNode();
+                ie1->m_N1->SetUWPnt( e1 );
+                ie1->m_N1->SetXYZPnt( e1xyz );
+                ie1->m_N1->MakePntUW();
+                ie1->m_N1->SetCoordInfo( info );
+
+                t0->m_ISectEdgeVec.push_back( ie0 );
+                t1->m_ISectEdgeVec.push_back( ie1 );
+
+                if ( tri->GetTMeshPtr() )
+                {
+                    tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+                }
+
+            }
+        }
+        else
+        {
+            TEdge* ie0 = new TEdge();
+            ie0->m_N0 = new TNode();
+            ie0->m_N0->m_Pnt = e0;
+            ie0->m_N1 = new TNode();
+            ie0->m_N1->m_Pnt = e1;
+
+            TEdge* ie1 = new TEdge();
+            ie1->m_N0 = new TNode();
+            ie1->m_N0->m_Pnt = e0;
+            ie1->m_N1 = new TNode();
+            ie1->m_N1->m_Pnt = e1;
+
+
+            if ( dist( e0, e1 ) > 0.000001 )
+            {
+                t0->m_ISectEdgeVec.push_back( ie0 );
+                t1->m_ISectEdgeVec.push_back( ie1 );
+            }
+            else
+            {
+                delete ie0->m_N0;
+                delete ie0->m_N1;
+                delete ie1->m_N0;
+                delete ie1->m_N1;
+                delete ie0;
+                delete ie1;
+            }
+        }
+    }
+}
+
+//==== Only This Mesh's Tris Get ISect Edges - tm Is Not Modified ====//
+void TMesh::IntersectSlice( TMesh* tm )
+{
+    vector< pair< int, int > > leafPairVec;
+    m_TriBVH.AddOverlapLeafPairs( tm->m_TriBVH, leafPairVec );
+
+    vector< TTriISect > isectVec;
+    for ( int i = 0 ; i < ( int )leafPairVec.size() ; i++ )
+    {
+        m_TriBVH.IntersectLeaf( leafPairVec[i].first, tm->m_TriBVH, leafPairVec[i].second, isectVec );
+    }
+
+    for ( int i = 0 ; i < ( int )isectVec.size() ; i++ )
+    {
+        isectVec[i].AddTri0ISectEdge();
+    }
 }
 
 void TMesh::Split( int meshFlag )
@@ -743,22 +881,25 @@ void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
 {
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
-        TTri* tri = m_TVec[t];
+        DeterIntExtParentTri( m_TVec[t], meshVec );
+    }
+}
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
-        {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
-        }
-        else
+void TMesh::DeterIntExtParentTri( TTri* tri, vector< TMesh* >& meshVec )
+{
+    //==== Do Interior Tris ====//
+    if ( tri->m_SplitVec.size() )
+    {
+        tri->m_InteriorFlag = 1;
+        for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
         {
-            DeterIntExtTri( tri, meshVec );
+            DeterIntExtTri( tri->m_SplitVec[s], meshVec );
         }
     }
+    else
+    {
+        DeterIntExtTri( tri, meshVec );
+    }
 }
 
 void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
@@ -774,7 +915,7 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
         if ( meshVec[m] != this )
         {
             vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
+            meshVec[m]->m_TriBVH.RayCast( orig, dir, tParmVec );
             if ( tParmVec.size() % 2 )
             {
                 tri->m_InteriorFlag = 1;
@@ -813,10 +954,24 @@ void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
 
 
 void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+{
+    tri->m_InteriorFlag = 1;
+
+    int owner = FindMassOwner( tri, meshVec );
+    if ( owner >= 0 )
+    {
+        tri->m_InteriorFlag = 0;
+        tri->m_ID = meshVec[owner]->m_PtrID;
+        tri->m_Mass = meshVec[owner]->m_Density;
+    }
+}
+
+//==== Index Of Highest Mass Priority Mesh Containing Tri Center (First Wins Ties), -1 If None ====//
+int TMesh::FindMassOwner( TTri* tri, vector< TMesh* >& meshVec )
 {
     vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
     orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 1;
+    int owner = -1;
     int prior = -1;
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
@@ -826,19 +981,18 @@ void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
         if ( meshVec[m] != this )
         {
             vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
+            meshVec[m]->m_TriBVH.RayCast( orig, dir, tParmVec );
             if ( tParmVec.size() % 2 )
             {
                 if ( meshVec[m]->m_MassPrior > prior )
                 {
-                    tri->m_InteriorFlag = 0;
-                    tri->m_ID = meshVec[m]->m_PtrID;
-                    tri->m_Mass = meshVec[m]->m_Density;
+                    owner = m;
                     prior = meshVec[m]->m_MassPrior;
                 }
             }
         }
     }
+    return owner;
 }
 
 double TMesh::ComputeTheoArea()
@@ -1076,14 +1230,18 @@ void TMesh::AddUWTri( const vec3d & uw0, const vec3d & uw1, const vec3d & uw2, c
 }
 
 
+//==== Bounds And BVH For Ray Casts And Intersections ====//
 void TMesh::LoadBndBox()
 {
+    m_BndBox.Reset();
     for ( int i = 0 ; i < ( int )m_TVec.size() ; i++ )
     {
-        m_TBox.AddTri( m_TVec[i] );
+        m_BndBox.Update( m_TVec[i]->m_N0->m_Pnt );
+        m_BndBox.Update( m_TVec[i]->m_N1->m_Pnt );
+        m_BndBox.Update( m_TVec[i]->m_N2->m_Pnt );
     }
 
-    m_TBox.SplitBox();
+    m_TriBVH.Build( m_TVec );
 }
 
 //==== Write STL Tris =====//
@@ -1186,9 +1344,6 @@ int TMesh::NumVerts()
 
 TTri::TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_InteriorFlag = 0;
@@ -1200,9 +1355,6 @@ TTri::TTri()
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
@@ -2390,415 +2542,33 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 
 
 
-//===============================================//
-//===============================================//
-//===============================================//
-//===============================================//
-//                  TBndBox
-//===============================================//
-//===============================================//
-//===============================================//
-//===============================================//
-
-TBndBox::TBndBox()
-{
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        m_SBoxVec[i] = 0;
-    }
-}
-
-TBndBox::~TBndBox()
-{
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        if ( m_SBoxVec[i] )
-        {
-            delete m_SBoxVec[i];
-        }
-    }
-}
-
-void TBndBox::Reset()
-{
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        if ( m_SBoxVec[i] )
-        {
-            delete m_SBoxVec[i];
-            m_SBoxVec[i] = 0;
-        }
-    }
-
-    m_Box.Reset();
-    m_TriVec.clear();
-}
-
-//==== Create Oct Tree of Overlaping BndBoxes ====//
-void TBndBox::SplitBox()
+void TTriISect::AddISectEdges()
 {
-    int i;
-    if ( m_TriVec.size() > 32 )
-    {
-        //==== Find Split Points ====//
-        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
-        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
-        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
+    TEdge* ie0 = new TEdge();
+    ie0->m_N0 = new TNode();
+    ie0->m_N0->m_Pnt = m_Pnt0;
+    ie0->m_N1 = new TNode();
+    ie0->m_N1->m_Pnt = m_Pnt1;
 
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i] = new TBndBox();
-        }
+    TEdge* ie1 = new TEdge();
+    ie1->m_N0 = new TNode();
+    ie1->m_N0->m_Pnt = m_Pnt0;
+    ie1->m_N1 = new TNode();
+    ie1->m_N1->m_Pnt = m_Pnt1;
 
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-        {
-            int cnt = 0;
-            if ( m_TriVec[i]->m_N0->m_Pnt.x() > hx )
-            {
-                cnt += 1;
-            }
-            if ( m_TriVec[i]->m_N0->m_Pnt.y() > hy )
-            {
-                cnt += 2;
-            }
-            if ( m_TriVec[i]->m_N0->m_Pnt.z() > hz )
-            {
-                cnt += 4;
-            }
-            m_SBoxVec[cnt]->AddTri( m_TriVec[i] );
-        }
-
-        int contSplitFlag = 1;
-
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            if ( m_TriVec.size() == m_SBoxVec[i]->m_TriVec.size() )
-            {
-                contSplitFlag = 0;
-                break;
-            }
-        }
-        if ( contSplitFlag )
-        {
-            for ( i = 0 ; i < 8 ; i++ )
-            {
-                m_SBoxVec[i]->SplitBox();
-            }
-        }
-    }
+    m_Tri0->m_ISectEdgeVec.push_back( ie0 );
+    m_Tri1->m_ISectEdgeVec.push_back( ie1 );
 }
 
-void TBndBox::AddTri( TTri* t )
+void TTriISect::AddTri0ISectEdge()
 {
-    m_TriVec.push_back( t );
-    m_Box.Update( t->m_N0->m_Pnt );
-    m_Box.Update( t->m_N1->m_Pnt );
-    m_Box.Update( t->m_N2->m_Pnt );
-}
-
-void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
-{
-    int i;
-
-    if ( m_SBoxVec[0] )     // Keep Moving Down
-    {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->AddLeafNodes( leafVec );
-        }
-    }
-    else
-    {
-        leafVec.push_back( this );
-    }
-}
-
-void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
-{
-    int i;
-
-    if ( !Compare( m_Box, iBox->m_Box ) )
-    {
-        return;
-    }
-
-    if ( m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            iBox->Intersect( m_SBoxVec[i], UWFlag );
-        }
-    }
-    else if ( iBox->m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            iBox->m_SBoxVec[i]->Intersect( this, UWFlag );
-        }
-    }
-    else
-    {
-        int i, j;
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
-
-        int iCnt = 0;
-
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-        {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
-                TTri* t1 = iBox->m_TriVec[j];
-
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
-
-                iCnt += iflag;
-                if ( iflag && !coplanarFlag )
-                {
-                    if ( UWFlag )
-                    {
-                        if ( dist( e0, e1 ) > 0.000001 )
-                        {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
-
-                        }
-                    }
-                    else
-                    {
-                        TEdge* ie0 = new TEdge();
-                        ie0->m_N0 = new TNode();
-                        ie0->m_N0->m_Pnt = e0;
-                        ie0->m_N1 = new TNode();
-                        ie0->m_N1->m_Pnt = e1;
-
-                        TEdge* ie1 = new TEdge();
-                        ie1->m_N0 = new TNode();
-                        ie1->m_N0->m_Pnt = e0;
-                        ie1->m_N1 = new TNode();
-                        ie1->m_N1->m_Pnt = e1;
-
-
-                        if ( dist( e0, e1 ) > 0.000001 )
-                        {
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-                        }
-                        else
-                        {
-                            delete ie0->m_N0;
-                            delete ie0->m_N1;
-                            delete ie1->m_N0;
-                            delete ie1->m_N1;
-                            delete ie0;
-                            delete ie1;
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
-{
-    int i;
-
-    if ( orig.y() < m_Box.GetMin( 1 ) )
-    {
-        return;
-    }
-    if ( orig.y() > m_Box.GetMax( 1 ) )
-    {
-        return;
-    }
-    if ( orig.z() < m_Box.GetMin( 2 ) )
-    {
-        return;
-    }
-    if ( orig.z() > m_Box.GetMax( 2 ) )
-    {
-        return;
-    }
-
-    if ( m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->NumCrossXRay( orig, tParmVec );
-        }
-        return;
-    }
-
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    vec3d dir( 1.0, 0.0, 0.0 );
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-    {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
-
-        if ( iFlag && tparm > 0.0 )
-        {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
-            {
-                if ( fabs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
-            }
-
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
-        }
-    }
-
-}
-
-void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
-{
-    int i;
-
-    double coord[3];
-
-    if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
-    {
-        return;
-    }
-
-    if ( m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->RayCast( orig, dir, tParmVec );
-        }
-        return;
-    }
-
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-    {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
-
-        if ( iFlag && tparm > 0.0 )
-        {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
-            {
-                if ( fabs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
-            }
-
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
-        }
-    }
-
-}
-
-void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
-{
-    int i, t;
-
-    if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
-    {
-        return;
-    }
-
-    if ( m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->SegIntersect( p0, p1, ipntVec );
-        }
-        return;
-    }
-
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    for ( t = 0 ; t < ( int )m_TriVec.size() ; t++ )
-    {
-        TTri* tri = m_TriVec[t];
-        vec3d n0pnt  = tri->m_N0->m_Pnt;
-        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d p10    = p1 - p0;
-        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
-                                p0, p10, uparm, vparm, tparm ) )
-        {
-            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
-            ipntVec.push_back( pnt );
-        }
-    }
+    TEdge* ie = new TEdge();
+    ie->m_N0 = new TNode();
+    ie->m_N0->m_Pnt = m_Pnt0;
+    ie->m_N1 = new TNode();
+    ie->m_N1->m_Pnt = m_Pnt1;
 
+    m_Tri0->m_ISectEdgeVec.push_back( ie );
 }
 
 
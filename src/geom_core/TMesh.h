@@ -24,6 +24,7 @@
 #include "BndBox.h"
 #include "DragFactors.h"
 #include "XmlUtil.h"
+#include "TriBVH.h"
 
 #include <vector>               //jrg windows?? 
 #include <algorithm>            //jrg windows??
@@ -40,7 +41,6 @@ extern "C"
 
 class TEdge;
 class TTri;
-class TBndBox;
 class NBndBox;
 class TNodeGroup;
 class TMesh;
@@ -345,28 +345,17 @@ private:
 
 };
 
-class TBndBox
+//==== Intersection Segment Found Between Two Tris, Before ISect Edges Are Added ====//
+class TTriISect
 {
 public:
-    TBndBox();
-    virtual ~TBndBox();
-
-    virtual void Reset();
-
-    BndBox m_Box;
-    vector< TTri* > m_TriVec;
-
-    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
-
-    void SplitBox();
-    void AddTri( TTri* t );
-    virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
-    virtual void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
-    virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
-    virtual void AddLeafNodes( vector< TBndBox* > & leafVec );
-
-    virtual void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
+    TTri* m_Tri0;
+    TTri* m_Tri1;
+    vec3d m_Pnt0;
+    vec3d m_Pnt1;
 
+    void AddISectEdges();
+    void AddTri0ISectEdge();
 };
 
 class NBndBox
@@ -398,7 +387,8 @@ public:
     vector< TNode* > m_NVec;
     vector< TEdge* > m_EVec;
 
-    TBndBox m_TBox;
+    BndBox m_BndBox;                // Bounds Of All Tris - Set By LoadBndBox
+    TriBVH m_TriBVH;
 
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
@@ -430,11 +420,15 @@ public:
     void LoadGeomAttributes( Geom* geomPtr );
     int  RemoveDegenerate();
     void Intersect( TMesh* tm, bool UWFlag = false );
+    static void IntersectTris( TTri* t0, TTri* t1, bool UWFlag );
+    void IntersectSlice( TMesh* tm );
     void Split( int meshFlag = 0 );
     void DeterIntExt( vector< TMesh* >& meshVec );
+    void DeterIntExtParentTri( TTri* tri, vector< TMesh* >& meshVec );
     void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
     void MassDeterIntExt( vector< TMesh* >& meshVec );
     void MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    int FindMassOwner( TTri* tri, vector< TMesh* >& meshVec );
 
     int DeterIntExtPnt( const vec3d& pnt, vector< TMesh* >& meshVec, TMesh* ignoreMesh = 0 );   // 1 Interior 0 Exterior
 
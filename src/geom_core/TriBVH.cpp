@@ -0,0 +1,544 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// TriBVH.cpp: implementation of the TriBVH class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "TriBVH.h"
+#include "TMesh.h"
+#include "Tritri.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+//==== Same Determinant Tolerance As intersect_triangle ====//
+static const double RAY_TRI_EPSILON = 0.000001;
+
+//==== Hits Closer Than This Along The Ray Count Once ====//
+static const double RAY_DUP_TOL = 0.0000001;
+
+//==== Half Surface Area Of Box - SAH Cost Metric ====//
+static double HalfArea( const double bmin[3], const double bmax[3] )
+{
+    double dx = bmax[0] - bmin[0];
+    double dy = bmax[1] - bmin[1];
+    double dz = bmax[2] - bmin[2];
+    return dx * dy + dy * dz + dz * dx;
+}
+
+static void InitBox( double bmin[3], double bmax[3] )
+{
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        bmin[i] = DBL_MAX;
+        bmax[i] = -DBL_MAX;
+    }
+}
+
+static void GrowBox( double bmin[3], double bmax[3], const double pmin[3], const double pmax[3] )
+{
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        bmin[i] = min( bmin[i], pmin[i] );
+        bmax[i] = max( bmax[i], pmax[i] );
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+TriBVH::TriBVH()
+{
+}
+
+TriBVH::~TriBVH()
+{
+}
+
+void TriBVH::Clear()
+{
+    m_NodeVec.clear();
+    m_TriVec.clear();
+    m_PacketVec.clear();
+}
+
+BndBox TriBVH::GetBox() const
+{
+    BndBox box;
+    if ( m_NodeVec.size() )
+    {
+        box.Update( vec3d( m_NodeVec[0].m_Min[0], m_NodeVec[0].m_Min[1], m_NodeVec[0].m_Min[2] ) );
+        box.Update( vec3d( m_NodeVec[0].m_Max[0], m_NodeVec[0].m_Max[1], m_NodeVec[0].m_Max[2] ) );
+    }
+    return box;
+}
+
+//==== Build Tree With Binned Surface Area Heuristic ====//
+void TriBVH::Build( const vector< TTri* > & triVec )
+{
+    Clear();
+
+    int num_tris = ( int )triVec.size();
+    if ( num_tris == 0 )
+    {
+        return;
+    }
+
+    vector< BuildTri > buildVec( num_tris );
+    vector< int > indVec( num_tris );
+
+    double rmin[3], rmax[3];
+    InitBox( rmin, rmax );
+
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        TTri* tri = triVec[i];
+        BuildTri & bt = buildVec[i];
+        for ( int j = 0 ; j < 3 ; j++ )
+        {
+            double p0 = tri->m_N0->m_Pnt[j];
+            double p1 = tri->m_N1->m_Pnt[j];
+            double p2 = tri->m_N2->m_Pnt[j];
+            bt.m_Min[j] = min( p0, min( p1, p2 ) );
+            bt.m_Max[j] = max( p0, max( p1, p2 ) );
+            bt.m_Cent[j] = ( p0 + p1 + p2 ) / 3.0;
+        }
+        GrowBox( rmin, rmax, bt.m_Min, bt.m_Max );
+        indVec[i] = i;
+    }
+
+    //==== Pad Tri Boxes So Rays Grazing A Box Face Are Not Lost To Round Off ====//
+    double pad = 1.0e-10 * max( rmax[0] - rmin[0], max( rmax[1] - rmin[1], rmax[2] - rmin[2] ) ) + 1.0e-14;
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        for ( int j = 0 ; j < 3 ; j++ )
+        {
+            buildVec[i].m_Min[j] -= pad;
+            buildVec[i].m_Max[j] += pad;
+        }
+    }
+
+    m_NodeVec.reserve( 2 * ( num_tris / TRI_PACKET_SIZE ) + 1 );
+    m_TriVec.reserve( num_tris + num_tris / 2 );
+
+    BuildNode( buildVec, indVec, 0, num_tris, triVec );
+
+    //==== Load Tri Packets ====//
+    m_PacketVec.resize( m_TriVec.size() / TRI_PACKET_SIZE );
+    for ( int i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    {
+        LoadPacket( i, m_TriVec[i] );
+    }
+}
+
+int TriBVH::BuildNode( vector< BuildTri > & buildVec, vector< int > & indVec, int start, int end, const vector< TTri* > & triVec )
+{
+    int node_id = ( int )m_NodeVec.size();
+    m_NodeVec.push_back( Node() );
+
+    int num = end - start;
+
+    Node n;
+    double cmin[3], cmax[3];
+    InitBox( n.m_Min, n.m_Max );
+    InitBox( cmin, cmax );
+    for ( int i = start ; i < end ; i++ )
+    {
+        const BuildTri & bt = buildVec[ indVec[i] ];
+        GrowBox( n.m_Min, n.m_Max, bt.m_Min, bt.m_Max );
+        GrowBox( cmin, cmax, bt.m_Cent, bt.m_Cent );
+    }
+
+    //==== Split Along Longest Centroid Extent ====//
+    int axis = 0;
+    for ( int j = 1 ; j < 3 ; j++ )
+    {
+        if ( cmax[j] - cmin[j] > cmax[axis] - cmin[axis] )
+        {
+            axis = j;
+        }
+    }
+    double ext = cmax[axis] - cmin[axis];
+
+    int mid = -1;
+    if ( num > TRI_PACKET_SIZE && ext > 0.0 )
+    {
+        int bin_cnt[NUM_SAH_BINS];
+        double bin_min[NUM_SAH_BINS][3], bin_max[NUM_SAH_BINS][3];
+        for ( int b = 0 ; b < NUM_SAH_BINS ; b++ )
+        {
+            bin_cnt[b] = 0;
+            InitBox( bin_min[b], bin_max[b] );
+        }
+
+        double scale = NUM_SAH_BINS / ext;
+        for ( int i = start ; i < end ; i++ )
+        {
+            const BuildTri & bt = buildVec[ indVec[i] ];
+            int b = min( ( int )( ( bt.m_Cent[axis] - cmin[axis] ) * scale ), NUM_SAH_BINS - 1 );
+            bin_cnt[b]++;
+            GrowBox( bin_min[b], bin_max[b], bt.m_Min, bt.m_Max );
+        }
+
+        //==== Sweep From Right To Find Cost Of Each Right Side ====//
+        double right_area[NUM_SAH_BINS];
+        int right_cnt[NUM_SAH_BINS];
+        double smin[3], smax[3];
+        InitBox( smin, smax );
+        int cnt = 0;
+        for ( int b = NUM_SAH_BINS - 1 ; b > 0 ; b-- )
+        {
+            cnt += bin_cnt[b];
+            if ( bin_cnt[b] )
+            {
+                GrowBox( smin, smax, bin_min[b], bin_max[b] );
+            }
+            right_cnt[b] = cnt;
+            right_area[b] = cnt ? HalfArea( smin, smax ) : 0.0;
+        }
+
+        //==== Sweep From Left And Pick Cheapest Split ====//
+        int best_bin = -1;
+        double best_cost = DBL_MAX;
+        InitBox( smin, smax );
+        cnt = 0;
+        for ( int b = 1 ; b < NUM_SAH_BINS ; b++ )
+        {
+            cnt += bin_cnt[b - 1];
+            if ( bin_cnt[b - 1] )
+            {
+                GrowBox( smin, smax, bin_min[b - 1], bin_max[b - 1] );
+            }
+            if ( cnt == 0 || right_cnt[b] == 0 )
+            {
+                continue;
+            }
+            double cost = HalfArea( smin, smax ) * cnt + right_area[b] * right_cnt[b];
+            if ( cost < best_cost )
+            {
+                best_cost = cost;
+                best_bin = b;
+            }
+        }
+
+        double leaf_cost = HalfArea( n.m_Min, n.m_Max ) * num;
+        if ( best_bin > 0 && ( best_cost < leaf_cost || num > MAX_LEAF_TRIS ) )
+        {
+            int* split = std::partition( &indVec[0] + start, &indVec[0] + end, [&]( int ind )
+            {
+                int b = min( ( int )( ( buildVec[ind].m_Cent[axis] - cmin[axis] ) * scale ), NUM_SAH_BINS - 1 );
+                return b < best_bin;
+            } );
+            mid = ( int )( split - &indVec[0] );
+        }
+    }
+
+    //==== Coincident Centroids Or Failed Partition - Split At Median ====//
+    if ( num > MAX_LEAF_TRIS && ( mid <= start || mid >= end ) )
+    {
+        mid = start + num / 2;
+        std::nth_element( indVec.begin() + start, indVec.begin() + mid, indVec.begin() + end, [&]( int a, int b )
+        {
+            return buildVec[a].m_Cent[axis] < buildVec[b].m_Cent[axis];
+        } );
+    }
+
+    if ( mid > start && mid < end )
+    {
+        BuildNode( buildVec, indVec, start, mid, triVec );
+        n.m_Start = BuildNode( buildVec, indVec, mid, end, triVec );
+        n.m_Count = 0;
+    }
+    else
+    {
+        n.m_Start = ( int )m_TriVec.size();
+        n.m_Count = num;
+        for ( int i = start ; i < end ; i++ )
+        {
+            m_TriVec.push_back( triVec[ indVec[i] ] );
+        }
+        while ( m_TriVec.size() % TRI_PACKET_SIZE )
+        {
+            m_TriVec.push_back( NULL );
+        }
+    }
+
+    m_NodeVec[node_id] = n;
+    return node_id;
+}
+
+//==== Empty Slots Get Zero Edges - Zero Determinant Never Hits ====//
+void TriBVH::LoadPacket( int slot, TTri* tri )
+{
+    TriPacket & p = m_PacketVec[ slot / TRI_PACKET_SIZE ];
+    int k = slot % TRI_PACKET_SIZE;
+
+    for ( int j = 0 ; j < 3 ; j++ )
+    {
+        if ( tri )
+        {
+            p.m_V0[j][k] = tri->m_N0->m_Pnt[j];
+            p.m_E1[j][k] = tri->m_N1->m_Pnt[j] - tri->m_N0->m_Pnt[j];
+            p.m_E2[j][k] = tri->m_N2->m_Pnt[j] - tri->m_N0->m_Pnt[j];
+        }
+        else
+        {
+            p.m_V0[j][k] = 0.0;
+            p.m_E1[j][k] = 0.0;
+            p.m_E2[j][k] = 0.0;
+        }
+    }
+}
+
+int TriBVH::GetLeafTris( int node, TTri* const* & tris ) const
+{
+    const Node & n = m_NodeVec[node];
+    tris = &m_TriVec[0] + n.m_Start;
+    return n.m_Count;
+}
+
+//==== Slab Test Against Half Line orig + t * dir, t >= 0 ====//
+bool TriBVH::RayHitsBox( const Node & n, const double orig[3], const double invDir[3], const bool zeroDir[3] )
+{
+    double tmin = 0.0;
+    double tmax = DBL_MAX;
+
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        if ( zeroDir[i] )
+        {
+            if ( orig[i] < n.m_Min[i] || orig[i] > n.m_Max[i] )
+            {
+                return false;
+            }
+            continue;
+        }
+
+        double t0 = ( n.m_Min[i] - orig[i] ) * invDir[i];
+        double t1 = ( n.m_Max[i] - orig[i] ) * invDir[i];
+        if ( t0 > t1 )
+        {
+            std::swap( t0, t1 );
+        }
+        tmin = max( tmin, t0 );
+        tmax = min( tmax, t1 );
+        if ( tmin > tmax )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Same Test And Tolerance As Compare( BndBox, BndBox ) ====//
+bool TriBVH::Overlap( const Node & n0, const Node & n1 )
+{
+    const double tol = 1.0e-12;
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        if ( ( n1.m_Min[i] - n0.m_Max[i] ) > tol || ( n0.m_Min[i] - n1.m_Max[i] ) > tol )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Non Culling Moller-Trumbore (intersect_triangle) Over All Lanes Of A Packet ====//
+void TriBVH::RayCastPacket( const TriPacket & p, const double orig[3], const double dir[3], vector< double > & tParmVec )
+{
+    double tparm[TRI_PACKET_SIZE];
+    int hit[TRI_PACKET_SIZE];
+
+    //==== No Branches Or Calls - Compiler Can Run The Lanes In Vector Registers ====//
+    for ( int k = 0 ; k < TRI_PACKET_SIZE ; k++ )
+    {
+        double e10 = p.m_E1[0][k];
+        double e11 = p.m_E1[1][k];
+        double e12 = p.m_E1[2][k];
+        double e20 = p.m_E2[0][k];
+        double e21 = p.m_E2[1][k];
+        double e22 = p.m_E2[2][k];
+
+        double pv0 = dir[1] * e22 - dir[2] * e21;
+        double pv1 = dir[2] * e20 - dir[0] * e22;
+        double pv2 = dir[0] * e21 - dir[1] * e20;
+
+        double det = e10 * pv0 + e11 * pv1 + e12 * pv2;
+        int det_ok = ( det <= -RAY_TRI_EPSILON ) | ( det >= RAY_TRI_EPSILON );
+        double inv_det = 1.0 / ( det_ok ? det : 1.0 );
+
+        double tv0 = orig[0] - p.m_V0[0][k];
+        double tv1 = orig[1] - p.m_V0[1][k];
+        double tv2 = orig[2] - p.m_V0[2][k];
+
+        double u = ( tv0 * pv0 + tv1 * pv1 + tv2 * pv2 ) * inv_det;
+
+        double qv0 = tv1 * e12 - tv2 * e11;
+        double qv1 = tv2 * e10 - tv0 * e12;
+        double qv2 = tv0 * e11 - tv1 * e10;
+
+        double v = ( dir[0] * qv0 + dir[1] * qv1 + dir[2] * qv2 ) * inv_det;
+        double t = ( e20 * qv0 + e21 * qv1 + e22 * qv2 ) * inv_det;
+
+        tparm[k] = t;
+        hit[k] = det_ok & ( u >= 0.0 ) & ( u <= 1.0 ) & ( v >= 0.0 ) & ( u + v <= 1.0 ) & ( t > 0.0 );
+    }
+
+    for ( int k = 0 ; k < TRI_PACKET_SIZE ; k++ )
+    {
+        if ( hit[k] )
+        {
+            tParmVec.push_back( tparm[k] );
+        }
+    }
+}
+
+void TriBVH::RayCast( const vec3d & orig, const vec3d & dir, vector< double > & tParmVec ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    double invDir[3];
+    bool zeroDir[3];
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        zeroDir[i] = ( dir.v[i] == 0.0 );
+        invDir[i] = zeroDir[i] ? 0.0 : 1.0 / dir.v[i];
+    }
+
+    int first = ( int )tParmVec.size();
+
+    vector< int > stack;
+    stack.reserve( 64 );
+    stack.push_back( 0 );
+
+    while ( stack.size() )
+    {
+        const Node & n = m_NodeVec[ stack.back() ];
+        int node_id = stack.back();
+        stack.pop_back();
+
+        if ( !RayHitsBox( n, orig.v, invDir, zeroDir ) )
+        {
+            continue;
+        }
+
+        if ( n.m_Count )
+        {
+            int p0 = n.m_Start / TRI_PACKET_SIZE;
+            int p1 = ( n.m_Start + n.m_Count + TRI_PACKET_SIZE - 1 ) / TRI_PACKET_SIZE;
+            for ( int p = p0 ; p < p1 ; p++ )
+            {
+                RayCastPacket( m_PacketVec[p], orig.v, dir.v, tParmVec );
+            }
+        }
+        else
+        {
+            stack.push_back( n.m_Start );
+            stack.push_back( node_id + 1 );
+        }
+    }
+
+    //==== Sort And Drop Duplicates (Ray Through Shared Edge Or Node) ====//
+    std::sort( tParmVec.begin() + first, tParmVec.end() );
+
+    int num = first;
+    for ( int i = first ; i < ( int )tParmVec.size() ; i++ )
+    {
+        if ( num == first || fabs( tParmVec[i] - tParmVec[num - 1] ) >= RAY_DUP_TOL )
+        {
+            tParmVec[num] = tParmVec[i];
+            num++;
+        }
+    }
+    tParmVec.resize( num );
+}
+
+void TriBVH::AddOverlapLeafPairs( const TriBVH & ibvh, vector< pair< int, int > > & leafPairVec ) const
+{
+    if ( m_NodeVec.empty() || ibvh.m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    vector< pair< int, int > > stack;
+    stack.reserve( 128 );
+    stack.push_back( pair< int, int >( 0, 0 ) );
+
+    while ( stack.size() )
+    {
+        pair< int, int > p = stack.back();
+        stack.pop_back();
+
+        const Node & n0 = m_NodeVec[p.first];
+        const Node & n1 = ibvh.m_NodeVec[p.second];
+
+        if ( !Overlap( n0, n1 ) )
+        {
+            continue;
+        }
+
+        bool leaf0 = n0.m_Count > 0;
+        bool leaf1 = n1.m_Count > 0;
+
+        if ( leaf0 && leaf1 )
+        {
+            leafPairVec.push_back( p );
+        }
+        //==== Descend The Larger Interior Node ====//
+        else if ( leaf1 || ( !leaf0 && HalfArea( n0.m_Min, n0.m_Max ) >= HalfArea( n1.m_Min, n1.m_Max ) ) )
+        {
+            stack.push_back( pair< int, int >( n0.m_Start, p.second ) );
+            stack.push_back( pair< int, int >( p.first + 1, p.second ) );
+        }
+        else
+        {
+            stack.push_back( pair< int, int >( p.first, n1.m_Start ) );
+            stack.push_back( pair< int, int >( p.first, p.second + 1 ) );
+        }
+    }
+}
+
+void TriBVH::IntersectLeaf( int node, const TriBVH & ibvh, int inode, vector< TTriISect > & isectVec ) const
+{
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    TTri* const* tris0;
+    TTri* const* tris1;
+    int num0 = GetLeafTris( node, tris0 );
+    int num1 = ibvh.GetLeafTris( inode, tris1 );
+
+    for ( int i = 0 ; i < num0 ; i++ )
+    {
+        TTri* t0 = tris0[i];
+        for ( int j = 0 ; j < num1 ; j++ )
+        {
+            TTri* t1 = tris1[j];
+
+            int iflag = tri_tri_intersect_with_isectline(
+                            t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                            t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                            &coplanarFlag, e0.v, e1.v );
+
+            if ( iflag && !coplanarFlag && dist( e0, e1 ) > 0.000001 )
+            {
+                TTriISect isect;
+                isect.m_Tri0 = t0;
+                isect.m_Tri1 = t1;
+                isect.m_Pnt0 = e0;
+                isect.m_Pnt1 = e1;
+                isectVec.push_back( isect );
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+//////////////////////////////////////////////////////////////////////
+// TriBVH.h
+// Flat bounding volume hierarchy over the tris of a TMesh
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(TRIBVH__INCLUDED_)
+#define TRIBVH__INCLUDED_
+
+#include "Vec3d.h"
+#include "BndBox.h"
+
+#include <vector>
+#include <utility>
+using namespace std;
+
+class TTri;
+class TTriISect;
+
+//////////////////////////////////////////////////////////////////////
+// Nodes are stored depth first in one array - the left child of an
+// interior node directly follows it, the right child is m_Start.  Tris
+// are sorted into leaf order and padded to groups of TRI_PACKET_SIZE;
+// each group is also stored as a TriPacket (structure of arrays) so the
+// ray/tri test runs over a whole packet in one straight loop.
+//////////////////////////////////////////////////////////////////////
+class TriBVH
+{
+public:
+    TriBVH();
+    virtual ~TriBVH();
+
+    enum { TRI_PACKET_SIZE = 4, MAX_LEAF_TRIS = 16, NUM_SAH_BINS = 16 };
+
+    virtual void Clear();
+    virtual void Build( const vector< TTri* > & triVec );
+
+    bool IsEmpty() const
+    {
+        return m_NodeVec.empty();
+    }
+    int GetNumNodes() const
+    {
+        return ( int )m_NodeVec.size();
+    }
+    BndBox GetBox() const;
+
+    //==== All Positive T Parms Where Ray Crosses Tris - Sorted, Duplicates Removed ====//
+    virtual void RayCast( const vec3d & orig, const vec3d & dir, vector< double > & tParmVec ) const;
+
+    //==== Leaf Node Pairs Whose Boxes Overlap ====//
+    virtual void AddOverlapLeafPairs( const TriBVH & ibvh, vector< pair< int, int > > & leafPairVec ) const;
+
+    //==== Tris Of Leaf Node - Returns Number Of Tris ====//
+    int GetLeafTris( int node, TTri* const* & tris ) const;
+
+    //==== Only Reads Tris - Safe To Run Concurrently With Other Leaf Pairs ====//
+    virtual void IntersectLeaf( int node, const TriBVH & ibvh, int inode, vector< TTriISect > & isectVec ) const;
+
+protected:
+
+    struct Node
+    {
+        double m_Min[3];
+        double m_Max[3];
+        int m_Start;                // Leaf: First Tri Slot, Interior: Right Child
+        int m_Count;                // Leaf: Num Tris, Interior: 0
+    };
+
+    struct TriPacket
+    {
+        double m_V0[3][TRI_PACKET_SIZE];
+        double m_E1[3][TRI_PACKET_SIZE];
+        double m_E2[3][TRI_PACKET_SIZE];
+    };
+
+    struct BuildTri
+    {
+        double m_Min[3];
+        double m_Max[3];
+        double m_Cent[3];
+    };
+
+    int BuildNode( vector< BuildTri > & buildVec, vector< int > & indVec, int start, int end, const vector< TTri* > & triVec );
+    void LoadPacket( int slot, TTri* tri );
+
+    static bool RayHitsBox( const Node & n, const double orig[3], const double invDir[3], const bool zeroDir[3] );
+    static bool Overlap( const Node & n0, const Node & n1 );
+    static void RayCastPacket( const TriPacket & p, const double orig[3], const double dir[3], vector< double > & tParmVec );
+
+    vector< Node > m_NodeVec;
+    vector< TTri* > m_TriVec;           // Leaf Order, NULL Padded
+    vector< TriPacket > m_PacketVec;    // One Per TRI_PACKET_SIZE Tri Slots
+
+};
+
+#endif
@@ -164,6 +164,7 @@ void Vehicle::Wype()
     }
 
     m_GeomStoreVec.clear();
+    m_GeomStoreMap.clear();
 
     m_ActiveGeom.clear();
     m_TopGeom.clear();
@@ -230,6 +231,131 @@ void Vehicle::Update()
     }
 }
 
+//==== Start Deferring Parm Updates ====//
+void Vehicle::BeginParmTransaction()
+{
+    ParmMgr.BeginTransaction();
+}
+
+//==== Apply Parm Changes Made Since BeginParmTransaction ====//
+void Vehicle::CommitParmTransaction()
+{
+    if ( ParmMgr.GetTransactionDepth() == 0 )
+    {
+        return;
+    }
+
+    //==== Nested Transaction - Outermost Commit Applies Changes ====//
+    vector< string > parm_vec;
+    if ( ParmMgr.GetTransactionDepth() > 1 )
+    {
+        ParmMgr.EndTransaction( parm_vec );
+        return;
+    }
+
+    //==== Propagate Links - Linked Parms Are Added To The Transaction ====//
+    string pid;
+    ParmMgr.SetTransactionLinkFlag( true );
+    while ( ParmMgr.PopTransactionLinkParm( pid ) )
+    {
+        LinkMgr.ParmChanged( pid, false );
+    }
+    ParmMgr.SetTransactionLinkFlag( false );
+
+    ParmMgr.EndTransaction( parm_vec );
+
+    //==== Hand Changed Parms To Owning Geoms, Collect Other Containers ====//
+    vector< Geom* > geom_vec;
+    vector< ParmContainer* > container_vec;
+    vector< Parm* > container_parm_vec;
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        Parm* parm_ptr = ParmMgr.FindParm( parm_vec[i] );
+        if ( !parm_ptr || !parm_ptr->GetContainer() )
+        {
+            continue;
+        }
+
+        Geom* geom_ptr = NULL;
+        ParmContainer* pc = parm_ptr->GetContainer();
+        while ( pc && !geom_ptr )
+        {
+            geom_ptr = FindGeom( pc->GetID() );
+            pc = pc->GetParentContainerPtr();
+        }
+
+        if ( geom_ptr )
+        {
+            //==== XSecs Etc. Between Parm And Geom Rebuild When Geom Asks ====//
+            for ( pc = parm_ptr->GetContainer() ; pc && pc != geom_ptr ; pc = pc->GetParentContainerPtr() )
+            {
+                pc->SetLateUpdateFlag( true );
+            }
+
+            geom_ptr->ParmChanged( parm_ptr, Parm::SET );
+
+            if ( !vector_contains_val( geom_vec, geom_ptr ) )
+            {
+                geom_vec.push_back( geom_ptr );
+            }
+        }
+        else
+        {
+            int ind = -1;
+            for ( int j = 0 ; j < ( int )container_vec.size() ; j++ )
+            {
+                if ( container_vec[j] == parm_ptr->GetContainer() )
+                {
+                    ind = j;
+                }
+            }
+
+            if ( ind < 0 )
+            {
+                container_vec.push_back( parm_ptr->GetContainer() );
+                container_parm_vec.push_back( parm_ptr );
+            }
+            else
+            {
+                container_parm_vec[ind] = parm_ptr;
+            }
+        }
+    }
+
+    //==== Parents Before Children - Parent Update Usually Updates Changed Children ====//
+    vector< pair< int, int > > depth_vec( geom_vec.size() );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        int depth = 0;
+        Geom* parent_ptr = FindGeom( geom_vec[i]->GetParentID() );
+        while ( parent_ptr )
+        {
+            depth++;
+            parent_ptr = FindGeom( parent_ptr->GetParentID() );
+        }
+        depth_vec[i] = make_pair( depth, i );
+    }
+    std::sort( depth_vec.begin(), depth_vec.end() );
+
+    for ( int i = 0 ; i < ( int )depth_vec.size() ; i++ )
+    {
+        Geom* geom_ptr = geom_vec[ depth_vec[i].second ];
+        if ( geom_ptr->GetLateUpdateFlag() )
+        {
+            geom_ptr->Update();
+        }
+    }
+
+    //==== Other Containers Update Once ====//
+    for ( int i = 0 ; i < ( int )container_vec.size() ; i++ )
+    {
+        container_vec[i]->ParmChanged( container_parm_vec[i], Parm::SET_FROM_DEVICE );
+    }
+
+    UpdateBBox();
+    UpdateGui();
+}
+
 //===== Run Script ====//
 void Vehicle::RunScript( const string & file_name, const string & function_name )
 {
@@ -240,24 +366,19 @@ void Vehicle::RunScript( const string & file_name, const string & function_name
 //==== Find Geom Based on GeomID ====//
 Geom* Vehicle::FindGeom( const string & geom_id )
 {
-    if ( geom_id == string( "NONE" ) )
+    unordered_map< string, Geom* >::const_iterator iter = m_GeomStoreMap.find( geom_id );
+    if ( iter == m_GeomStoreMap.end() )
     {
         return NULL;
     }
-    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
-    {
-        if ( m_GeomStoreVec[i]->IsMatch( geom_id ) )
-        {
-            return m_GeomStoreVec[i];
-        }
-    }
-    return NULL;
+    return iter->second;
 }
 
 //==== Find Vector of Geom Ptrs Based on GeomID ====//
 vector< Geom* > Vehicle::FindGeomVec( const vector< string > & geom_id_vec )
 {
     vector< Geom* > geom_vec;
+    geom_vec.reserve( geom_id_vec.size() );
     for ( int i = 0 ; i < ( int )geom_id_vec.size() ; i++ )
     {
         Geom* gptr = FindGeom( geom_id_vec[i] );
@@ -269,6 +390,38 @@ vector< Geom* > Vehicle::FindGeomVec( const vector< string > & geom_id_vec )
     return geom_vec;
 }
 
+//==== Add Geom To Storage And ID Index ====//
+void Vehicle::AddGeomToStore( Geom* geom_ptr )
+{
+    m_GeomStoreVec.push_back( geom_ptr );
+    m_GeomStoreMap[ geom_ptr->GetID() ] = geom_ptr;
+}
+
+//==== Remove Geom From Storage And ID Index - Does Not Delete ====//
+void Vehicle::RemoveGeomFromStore( Geom* geom_ptr )
+{
+    vector_remove_val( m_GeomStoreVec, geom_ptr );
+
+    unordered_map< string, Geom* >::iterator iter = m_GeomStoreMap.find( geom_ptr->GetID() );
+    if ( iter != m_GeomStoreMap.end() && iter->second == geom_ptr )
+    {
+        m_GeomStoreMap.erase( iter );
+    }
+}
+
+//==== Re-Key Stored Geom After Its ID Changed (Paste, Decode) ====//
+void Vehicle::ChangeGeomStoreID( const string & old_id, Geom* geom_ptr )
+{
+    unordered_map< string, Geom* >::iterator iter = m_GeomStoreMap.find( old_id );
+    if ( iter == m_GeomStoreMap.end() || iter->second != geom_ptr )
+    {
+        return;
+    }
+
+    m_GeomStoreMap.erase( iter );
+    m_GeomStoreMap[ geom_ptr->GetID() ] = geom_ptr;
+}
+
 
 //=== Create Geom of Type, Add To Storage and Return ID ====//
 string Vehicle::CreateGeom( const GeomType & type )
@@ -309,7 +462,7 @@ string Vehicle::CreateGeom( const GeomType & type )
     }
 
     new_geom->Update();
-    m_GeomStoreVec.push_back( new_geom );
+    AddGeomToStore( new_geom );
 
     Geom* type_geom_ptr = FindGeom( type.m_GeomID );
     if ( type_geom_ptr )
@@ -667,7 +820,7 @@ void Vehicle::DeleteClipBoard()
         Geom* gPtr = FindGeom( m_ClipBoard[i] );
         if ( gPtr )
         {
-            vector_remove_val( m_GeomStoreVec, gPtr );
+            RemoveGeomFromStore( gPtr );
             delete gPtr;
         }
     }
@@ -679,7 +832,7 @@ void Vehicle::DeleteGeom( const string & geom_id )
     Geom* gPtr = FindGeom( geom_id );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveGeomFromStore( gPtr );
         vector_remove_val( m_ActiveGeom, geom_id );
         delete gPtr;
     }
@@ -974,7 +1127,7 @@ void Vehicle::DeleteType( int index )
     Geom* gPtr = FindGeom( type.m_GeomID );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveGeomFromStore( gPtr );
         delete gPtr;
     }
 
@@ -1965,7 +2118,7 @@ string Vehicle::CompGeomAndFlatten( int set, int sliceFlag, int meshFlag, int ha
     return id;
 }
 
-string Vehicle::MassProps( int set, int numSlices )
+string Vehicle::MassProps( int set, int numSlices, int mode )
 {
     string id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) == 0 )
@@ -2006,7 +2159,14 @@ string Vehicle::MassProps( int set, int numSlices )
 
     if ( mesh_ptr->m_TMeshVec.size() || mesh_ptr->m_PointMassVec.size() )
     {
-        mesh_ptr->MassSliceX( numSlices );
+        if ( mode == vsp::MASS_PROP_SURF_INTEGRAL )
+        {
+            mesh_ptr->MassSurfIntegral();
+        }
+        else
+        {
+            mesh_ptr->MassSliceX( numSlices );
+        }
         m_TotalMass = mesh_ptr->m_TotalMass;
         m_IxxIyyIzz = vec3d( mesh_ptr->m_TotalIxx, mesh_ptr->m_TotalIyy, mesh_ptr->m_TotalIzz );
         m_IxyIxzIyz = vec3d( mesh_ptr->m_TotalIxy, mesh_ptr->m_TotalIxz, mesh_ptr->m_TotalIyz );
@@ -2023,9 +2183,9 @@ string Vehicle::MassProps( int set, int numSlices )
     return id;
 }
 
-string Vehicle::MassPropsAndFlatten( int set, int numSlices )
+string Vehicle::MassPropsAndFlatten( int set, int numSlices, int mode )
 {
-    string id = MassProps( set, numSlices );
+    string id = MassProps( set, numSlices, mode );
     Geom* geom = FindGeom( id );
     if ( !geom )
     {
@@ -2254,27 +2414,17 @@ void Vehicle::CreateDegenGeom( int set )
     }
 
 
+    //==== Tessellate And Intersect Once - Mass Slicing Reuses The Trimmed Meshes ====//
     string id = AddMeshGeom( set );
     if ( id.compare( "NONE" ) != 0 )
     {
         MeshGeom* mesh_ptr = dynamic_cast<MeshGeom*> ( FindGeom( id ) );
         if ( mesh_ptr != NULL )
         {
-            mesh_ptr->degenGeomIntersectTrim(m_DegenGeomVec);
-            DeleteGeom( id );
-        }
-    }
-
-
-    id = AddMeshGeom( set );
-    if ( id.compare( "NONE" ) != 0 )
-    {
-        MeshGeom* mesh_ptr = dynamic_cast<MeshGeom*> ( FindGeom( id ) );
-        if ( mesh_ptr != NULL )
-        {
-            mesh_ptr->degenGeomMassSliceX(m_DegenGeomVec);
-            DeleteGeom( id );
+            mesh_ptr->degenGeomIntersectTrim( m_DegenGeomVec );
+            mesh_ptr->degenGeomMassSliceX( m_DegenGeomVec );
         }
+        DeleteGeom( id );
     }
 
 }
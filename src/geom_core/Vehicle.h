@@ -23,6 +23,7 @@
 #include "CfdMeshSettings.h"
 #include "ClippingMgr.h"
 #include "STEPutil.h"
+#include "APIDefines.h"
 
 #include <assert.h>
 
@@ -31,6 +32,8 @@
 #include <deque>
 #include <stack>
 #include <memory>
+#include <unordered_map>
+using std::unordered_map;
 
 
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
@@ -76,10 +79,15 @@ public:
 
     void Update();
     void UpdateGui();
+
+    //==== Parm Transaction - Commit Updates Each Changed Geom Once ====//
+    void BeginParmTransaction();
+    void CommitParmTransaction();
     void RunScript( const string & file_name, const string & function_name = "void main()" );
 
     Geom* FindGeom( const string & geom_id );
     vector< Geom* > FindGeomVec( const vector< string > & geom_id_vec );
+    void ChangeGeomStoreID( const string & old_id, Geom* geom_ptr );
 
     string CreateGeom( const GeomType & type );
     string AddGeom( const GeomType & type );
@@ -198,8 +206,8 @@ public:
     //Comp Geom
     string CompGeom( int set, int sliceFlag, int meshFlag, int halfFlag, int intSubsFlag = 1 );
     string CompGeomAndFlatten( int set, int sliceFlag, int meshFlag, int halfFlag, int intSubsFlag = 1 );
-    string MassProps( int set, int numSlices );
-    string MassPropsAndFlatten( int set, int numSlices );
+    string MassProps( int set, int numSlices, int mode = vsp::MASS_PROP_SLICE );
+    string MassPropsAndFlatten( int set, int numSlices, int mode = vsp::MASS_PROP_SLICE );
     string AwaveSlice( int set, int numSlices, int numRots, double AngleControlVal, bool computeAngle,
                        vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
     string AwaveSliceAndFlatten( int set, int numSlices, int numRots, double AngleControlVal, bool computeAngle,
@@ -209,7 +217,7 @@ public:
 
     //==== Degenerate Geometry ====//
     void CreateDegenGeom( int set );
-    vector< DegenGeom > GetDegenGeomVec()	{ return m_DegenGeomVec; }
+    const vector< DegenGeom > & GetDegenGeomVec() const    { return m_DegenGeomVec; }
     string WriteDegenGeomFile();
 
     CfdMeshSettings* GetCfdSettingsPtr()
@@ -249,6 +257,10 @@ public:
 protected:
 
     vector< Geom* > m_GeomStoreVec;                 // All Geom Ptrs
+    unordered_map< string, Geom* > m_GeomStoreMap;  // ID->Geom Index Of m_GeomStoreVec
+
+    void AddGeomToStore( Geom* geom_ptr );
+    void RemoveGeomFromStore( Geom* geom_ptr );
 
     vector< DegenGeom > m_DegenGeomVec;         // Vector of components in degenerate representation
     vector< DegenPtMass > m_DegenPtMassVec;
@@ -540,10 +540,13 @@ void WingSect::Update()
 
     m_TransformedCurve.Transform( m_Transform );
 
+    vector< double > old_key;
+    old_key.swap( m_PlacementKey );
+    LoadPlacementKey( m_PlacementKey );
 
-    //==== Inform Outboard Section of Change ====//
+    //==== Inform Outboard Section Only If Placement Moved ====//
     int indx = xsecsurf->FindXSecIndex( m_ID );
-    if( indx < xsecsurf->NumXSec() - 1 )
+    if( m_PlacementKey != old_key && indx < xsecsurf->NumXSec() - 1 )
     {
         WingSect* nextxs = (WingSect*) xsecsurf->FindXSec( indx + 1);
         if( nextxs )
@@ -555,6 +558,47 @@ void WingSect::Update()
 }
 
 
+//==== Placement Set By WingGeom That Curve Depends On ====//
+void WingSect::LoadPlacementKey( vector< double > & key )
+{
+    key.resize( 9 + 16 );
+    key[0] = m_XDelta;
+    key[1] = m_YDelta;
+    key[2] = m_ZDelta;
+    key[3] = m_XRotate;
+    key[4] = m_YRotate;
+    key[5] = m_ZRotate;
+    key[6] = m_XCenterRot;
+    key[7] = m_YCenterRot;
+    key[8] = m_ZCenterRot;
+
+    XSecSurf* xsecsurf = (XSecSurf*) GetParentContainerPtr();
+    if ( xsecsurf )
+    {
+        Matrix4d global = xsecsurf->GetGlobalXForm();
+        for ( int i = 0 ; i < 16 ; i++ )
+        {
+            key[9 + i] = global.data()[i];
+        }
+    }
+}
+
+//==== Parm Changes Already Set LateUpdateFlag, Placement Does Not ====//
+void WingSect::CheckPlacement()
+{
+    if ( m_LateUpdateFlag )
+    {
+        return;
+    }
+
+    vector< double > key;
+    LoadPlacementKey( key );
+    if ( key != m_PlacementKey )
+    {
+        m_LateUpdateFlag = true;
+    }
+}
+
 //==== Copy position from base class ====//
 void WingSect::CopyBasePos( XSec* xs )
 {
@@ -1132,6 +1176,7 @@ void WingGeom::UpdateSurf()
             ws->m_YCenterRot = ws->m_YDelta;
             ws->m_ZCenterRot = ws->m_ZDelta;
 
+            ws->CheckPlacement();
             crv_vec[i] =  ws->GetCurve();
 
             if ( i > 0 )
@@ -1141,7 +1186,32 @@ void WingGeom::UpdateSurf()
         }
     }
 
-    m_MainSurfVec[0].SkinC0( crv_vec, false );
+    //==== Re-Skin Only Spans Next To Changed Sections ====//
+    int nsect = ( int )crv_vec.size();
+    bool skin_flag = ( ( int )m_SkinCrvVec.size() != nsect );
+    if ( !skin_flag )
+    {
+        vector< bool > changed_vec( nsect, false );
+        bool any_changed = false;
+        for ( int i = 0 ; i < nsect ; i++ )
+        {
+            changed_vec[i] = !( crv_vec[i].GetCurve() == m_SkinCrvVec[i].GetCurve() );
+            any_changed = any_changed || changed_vec[i];
+        }
+
+        if ( any_changed )
+        {
+            skin_flag = !m_SkinSurf.SkinC0Patches( crv_vec, changed_vec );
+        }
+    }
+
+    if ( skin_flag )
+    {
+        m_SkinSurf.SkinC0( crv_vec, false );
+    }
+    m_SkinCrvVec = crv_vec;
+
+    m_MainSurfVec[0] = m_SkinSurf;
     if ( m_XSecSurf.GetFlipUD() )
     {
         m_MainSurfVec[0].FlipNormal();
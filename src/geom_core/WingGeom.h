@@ -54,6 +54,9 @@ public:
     virtual void SetProjectedSpan( double v )                        { m_ProjectedSpan = v; }
     virtual double GetTanSweepAt( double sweep, double loc  );
 
+    //==== Flag Cached Curve For Rebuild If Placement Changed Since It Was Built ====//
+    virtual void CheckPlacement();
+
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
 
@@ -93,8 +96,11 @@ public:
 
 protected:
 
+    virtual void LoadPlacementKey( vector< double > & key );
+
     double m_ProjectedSpan;
 
+    vector< double > m_PlacementKey;            // Placement Of Cached Curve
 
 
 };
@@ -181,6 +187,10 @@ protected:
 
     vector<int> m_TessUVec;
 
+    //==== Skin Before Caps And The Section Curves It Was Built From ====//
+    VspSurf m_SkinSurf;
+    vector< VspCurve > m_SkinCrvVec;
+
     bool m_Closed;
 
 
@@ -151,6 +151,17 @@ void ScreenMgr::MessageCallback( const MessageBase* from, const MessageData& dat
             }
         }
     }
+    else if ( data.m_String == string( "FEAMessage" ) )
+    {
+        FeaStructScreen* scr = ( FeaStructScreen* ) m_ScreenVec[VSP_FEA_MESH_SCREEN];
+        if ( scr )
+        {
+            for ( int i = 0; i < (int)data.m_StringVec.size(); i++ )
+            {
+                scr->addOutputText( data.m_StringVec[i].c_str() );
+            }
+        }
+    }
 }
 
 //==== Init All Screens ====//
@@ -48,6 +48,15 @@ vsp.SetParmVal( pod_id, "X_Location", "XForm", 3.0 )
 sym_flag_id = vsp.GetParm( pod_id, "Sym_Planar_Flag", "Sym" )
 vsp.SetParmVal( sym_flag_id, vsp.SYM_XZ )
 
+# Change Several Parms, Update Pod Once
+vsp.SetParmValsUpdate( [ len_id, y_loc_id ], [ 8.0, 1.5 ] )
+errorMgr.PopErrorAndPrint( stdout )
+
+vsp.BeginParmTransaction()
+vsp.SetParmValUpdate( len_id, 7.0 )
+vsp.SetParmValUpdate( y_loc_id, 1.0 )
+vsp.CommitParmTransaction()
+
 # Copy Pod Geom
 vsp.CopyGeomToClipboard( pod_id )
 vsp.PasteGeomClipboard( fuse_id ) # make fuse parent
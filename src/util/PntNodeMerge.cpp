@@ -12,6 +12,9 @@
 //******************************************************************************
 
 #include "PntNodeMerge.h"
+#include "UsingCpp11.h"
+
+#include <cmath>
 
 
 void PntNodeCloud::AddPntNodes( vector< vec3d > & pnts )
@@ -73,3 +76,104 @@ void IndexPntNodes( PntNodeCloud & cloud, double tol )
 
 
 
+
+int WeldPnts( const vector< vec3d > & pnts, double tol, vector< int > & pnt_map, vector< int > & unique_vec )
+{
+    pnt_map.assign( pnts.size(), -1 );
+    unique_vec.clear();
+
+    if ( pnts.empty() )
+    {
+        return 0;
+    }
+
+    BndBox box;
+    for ( size_t i = 0 ; i < pnts.size() ; i++ )
+    {
+        box.Update( pnts[i] );
+    }
+
+    //==== Size Cells So A Surface Mesh Puts A Few Pnts In Each ====//
+    double cell = max( tol, box.GetLargestDist() / sqrt( ( double )pnts.size() ) );
+    if ( cell <= 0.0 )
+    {
+        cell = 1.0;
+    }
+
+    vec3d min_pnt = box.GetMin();
+    long long ncell[3];
+    for ( int d = 0 ; d < 3 ; d++ )
+    {
+        ncell[d] = ( long long )( ( box.GetMax( d ) - box.GetMin( d ) ) / cell ) + 1;
+    }
+
+    unordered_map< long long, vector< int > > grid;
+    grid.reserve( pnts.size() );
+
+    double tol_sq = tol * tol;
+    for ( size_t i = 0 ; i < pnts.size() ; i++ )
+    {
+        long long ic[3];
+        for ( int d = 0 ; d < 3 ; d++ )
+        {
+            ic[d] = ( long long )( ( pnts[i][d] - min_pnt[d] ) / cell );
+            ic[d] = min( max( ic[d], 0LL ), ncell[d] - 1 );
+        }
+
+        //==== Search Neighboring Cells For An Already Kept Pnt ====//
+        int match = -1;
+        for ( long long dz = -1 ; dz <= 1 && match < 0 ; dz++ )
+        {
+            long long iz = ic[2] + dz;
+            if ( iz < 0 || iz >= ncell[2] )
+            {
+                continue;
+            }
+            for ( long long dy = -1 ; dy <= 1 && match < 0 ; dy++ )
+            {
+                long long iy = ic[1] + dy;
+                if ( iy < 0 || iy >= ncell[1] )
+                {
+                    continue;
+                }
+                for ( long long dx = -1 ; dx <= 1 && match < 0 ; dx++ )
+                {
+                    long long ix = ic[0] + dx;
+                    if ( ix < 0 || ix >= ncell[0] )
+                    {
+                        continue;
+                    }
+
+                    unordered_map< long long, vector< int > >::const_iterator iter;
+                    iter = grid.find( ix + ncell[0] * ( iy + ncell[1] * iz ) );
+                    if ( iter == grid.end() )
+                    {
+                        continue;
+                    }
+
+                    for ( size_t j = 0 ; j < iter->second.size() ; j++ )
+                    {
+                        if ( dist_squared( pnts[i], pnts[ iter->second[j] ] ) <= tol_sq )
+                        {
+                            match = iter->second[j];
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if ( match >= 0 )
+        {
+            pnt_map[i] = pnt_map[match];
+        }
+        else
+        {
+            pnt_map[i] = ( int )unique_vec.size();
+            unique_vec.push_back( ( int )i );
+            grid[ ic[0] + ncell[0] * ( ic[1] + ncell[1] * ic[2] ) ].push_back( ( int )i );
+        }
+    }
+
+    return ( int )unique_vec.size();
+}
@@ -16,6 +16,7 @@
 #define PNTNODEMERGE_H
 
 #include "Vec3d.h"
+#include "BndBox.h"
 
 #ifdef max
 #undef max
@@ -114,4 +115,11 @@ struct PntNodeCloud
 
 void IndexPntNodes( PntNodeCloud & cloud, double tol );
 
+//==== Weld Coincident Pnts ====//
+// Hash pnts onto a uniform grid and merge each pnt into the first earlier pnt within tol.
+// On return pnt_map[i] is the compacted index of the pnt i was merged into and
+// unique_vec[j] is the original index of the pnt kept for compacted index j.
+// Returns the number of unique pnts.
+int WeldPnts( const vector< vec3d > & pnts, double tol, vector< int > & pnt_map, vector< int > & unique_vec );
+
 #endif
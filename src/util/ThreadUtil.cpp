@@ -0,0 +1,94 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+#include "ThreadUtil.h"
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+static int s_NumThreads = 0;           // 0 -> Use Hardware Concurrency
+static thread_local bool s_InParallelFor = false;   // Calling Thread Is Already Running Loop Iterations
+
+int ThreadUtil::GetNumThreads()
+{
+    if ( s_NumThreads > 0 )
+    {
+        return s_NumThreads;
+    }
+
+    int nthread = ( int )std::thread::hardware_concurrency();
+    if ( nthread < 1 )
+    {
+        nthread = 1;
+    }
+    return nthread;
+}
+
+void ThreadUtil::SetNumThreads( int num_threads )
+{
+    s_NumThreads = num_threads;
+}
+
+//==== Dynamically Distribute Loop Indices Across Worker Threads ====//
+void ThreadUtil::ParallelFor( int n, const std::function< void( int, int ) > & func )
+{
+    if ( n <= 0 )
+    {
+        return;
+    }
+
+    int nthread = GetNumThreads();
+    if ( nthread > n )
+    {
+        nthread = n;
+    }
+
+    //==== Serial - Run On Calling Thread, Also When Nested In Another ParallelFor ====//
+    if ( nthread <= 1 || s_InParallelFor )
+    {
+        for ( int i = 0 ; i < n ; i++ )
+        {
+            func( i, 0 );
+        }
+        return;
+    }
+
+    std::atomic< int > next_index( 0 );
+
+    std::vector< std::thread > workers;
+    workers.reserve( nthread - 1 );
+
+    for ( int t = 0 ; t < nthread ; t++ )
+    {
+        std::function< void() > work = [ &next_index, &func, n, t ]()
+        {
+            s_InParallelFor = true;
+
+            int i;
+            while ( ( i = next_index.fetch_add( 1 ) ) < n )
+            {
+                func( i, t );
+            }
+
+            s_InParallelFor = false;
+        };
+
+        //==== Calling Thread Takes The Last Share ====//
+        if ( t == nthread - 1 )
+        {
+            work();
+        }
+        else
+        {
+            workers.push_back( std::thread( work ) );
+        }
+    }
+
+    for ( int t = 0 ; t < ( int )workers.size() ; t++ )
+    {
+        workers[t].join();
+    }
+}
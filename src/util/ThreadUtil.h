@@ -0,0 +1,31 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// ThreadUtil.h: Simple worker thread helpers for independent loop iterations.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSPTHREADUTIL__INCLUDED_)
+#define VSPTHREADUTIL__INCLUDED_
+
+#include <functional>
+
+//==== Thread Functions =====//
+namespace ThreadUtil
+{
+//==== Number of Worker Threads Used By ParallelFor (Default Hardware Concurrency) ====//
+int GetNumThreads();
+void SetNumThreads( int num_threads );
+
+//==== Call func( index, thread_index ) For Each index In [0,n) ====//
+// Indices are handed out dynamically so load imbalance between iterations is absorbed.
+// thread_index is in [0,GetNumThreads()) and may be used to select a per-thread buffer.
+// Iterations must be independent; func must not throw.
+// A ParallelFor called from inside func runs serially on that thread, with thread_index 0.
+void ParallelFor( int n, const std::function< void( int, int ) > & func );
+}
+
+
+#endif
@@ -10,11 +10,13 @@
 #include "Vec2d.h"
 #include "Defines.h"
 #include <float.h>
+#include <algorithm>
 #include "StringUtil.h"
 #include "StlHelper.h"
 #include "VspCurve.h"
 #include "VspSurf.h"
 #include "SuperEllipse.h"
+#include "ThreadUtil.h"
 
 
 //==== Test vec2d ====//
@@ -482,6 +484,158 @@ void UtilTestSuite::VspSurfTest()
 #endif
 }
 
+//==== Grid Tesselation Must Match Point By Point Evaluation ====//
+void UtilTestSuite::TessGridTest()
+{
+    //==== Skin Four Closed Sections - Three U Patches, Four W Patches ====//
+    vector< VspCurve > crv_vec( 4 );
+    vector< double > param( 5 );
+    for ( int i = 0 ; i < ( int )param.size() ; i++ )
+    {
+        param[i] = ( double )i;
+    }
+
+    double rad[] = { 0.5, 1.0, 1.5, 0.8 };
+    for ( int i = 0 ; i < ( int )crv_vec.size() ; i++ )
+    {
+        double x = ( double )i;
+        vector< vec3d > pnt_vec;
+        pnt_vec.push_back( vec3d( x, 0.0, -rad[i] ) );
+        pnt_vec.push_back( vec3d( x, 1.2 * rad[i], 0.0 ) );
+        pnt_vec.push_back( vec3d( x, 0.0, rad[i] ) );
+        pnt_vec.push_back( vec3d( x, -0.8 * rad[i], 0.0 ) );
+        crv_vec[i].InterpolateCSpline( pnt_vec, param, true );
+    }
+
+    VspSurf srf;
+    srf.SkinC0( crv_vec, false );
+    TEST_ASSERT( srf.GetNumSectU() == 3 );
+    TEST_ASSERT( srf.GetNumSectW() == 4 );
+
+    //==== Grid Large Enough To Be Split Across Threads ====//
+    int nu = 101;
+    int nv = 121;
+    vector< double > u( nu ), v( nv );
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        u[i] = srf.GetUMax() * ( double )i / ( double )( nu - 1 );
+    }
+    for ( int j = 0 ; j < nv ; j++ )
+    {
+        v[j] = srf.GetWMax() * ( double )j / ( double )( nv - 1 );
+    }
+
+    vector< vec3d > pnts, norms;
+    srf.TessGrid( u, v, pnts, norms );
+    TEST_ASSERT( ( int )pnts.size() == nu * nv );
+    TEST_ASSERT( ( int )norms.size() == nu * nv );
+
+    double max_pnt_err = 0.0;
+    double max_norm_err = 0.0;
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        for ( int j = 0 ; j < nv ; j++ )
+        {
+            max_pnt_err = std::max( max_pnt_err, dist( pnts[ i * nv + j ], srf.CompPnt( u[i], v[j] ) ) );
+
+            //==== Normals Jump Across C0 Section Joints - Compare Inside Patches ====//
+            if ( fabs( u[i] - floor( u[i] + 0.5 ) ) > 1.0e-6 )
+            {
+                max_norm_err = std::max( max_norm_err, dist( norms[ i * nv + j ], srf.CompNorm( u[i], v[j] ) ) );
+            }
+        }
+    }
+    TEST_ASSERT_DELTA( max_pnt_err, 0.0, 1.0e-10 );
+    TEST_ASSERT_DELTA( max_norm_err, 0.0, 1.0e-10 );
+
+    //==== Nested In ParallelFor - Runs Serially, Same Answer ====//
+    vector< vector< vec3d > > nest_pnts( 2 ), nest_norms( 2 );
+    ThreadUtil::ParallelFor( 2, [ & ]( int k, int ithread )
+    {
+        srf.TessGrid( u, v, nest_pnts[k], nest_norms[k] );
+    } );
+
+    for ( int k = 0 ; k < 2 ; k++ )
+    {
+        for ( int m = 0 ; m < nu * nv ; m++ )
+        {
+            TEST_ASSERT_DELTA( dist( nest_pnts[k][m], pnts[m] ), 0.0, 1.0e-14 );
+            TEST_ASSERT_DELTA( dist( nest_norms[k][m], norms[m] ), 0.0, 1.0e-14 );
+        }
+    }
+}
+
+//==== Closed Section At x For Skinning Tests ====//
+static VspCurve MakeSkinSect( double x, double rad, int npts )
+{
+    vector< double > param( npts + 1 );
+    vector< vec3d > pnt_vec( npts );
+    for ( int i = 0 ; i < npts ; i++ )
+    {
+        double theta = 2.0 * M_PI * ( double )i / ( double )npts;
+        pnt_vec[i] = vec3d( x, 1.2 * rad * cos( theta ), rad * sin( theta ) );
+        param[i] = ( double )i;
+    }
+    param[npts] = ( double )npts;
+
+    VspCurve crv;
+    crv.InterpolateCSpline( pnt_vec, param, true );
+    return crv;
+}
+
+//==== Re-Skinning Changed Spans Must Give The Same Surface As A Full Skin ====//
+void UtilTestSuite::SkinC0PatchesTest()
+{
+    double rad[] = { 0.5, 1.0, 1.5, 0.8, 0.6 };
+    vector< VspCurve > crv_vec( 5 );
+    for ( int i = 0 ; i < ( int )crv_vec.size() ; i++ )
+    {
+        crv_vec[i] = MakeSkinSect( ( double )i, rad[i], 4 );
+    }
+
+    VspSurf inc_srf;
+    inc_srf.SkinC0( crv_vec, false );
+
+    //==== Move And Resize Middle Section ====//
+    vector< VspCurve > new_crv_vec = crv_vec;
+    new_crv_vec[2] = MakeSkinSect( 2.3, 1.7, 4 );
+    new_crv_vec[2].OffsetZ( 0.2 );
+
+    vector< bool > changed_vec( crv_vec.size(), false );
+    changed_vec[2] = true;
+
+    TEST_ASSERT( inc_srf.SkinC0Patches( new_crv_vec, changed_vec ) );
+
+    VspSurf full_srf;
+    full_srf.SkinC0( new_crv_vec, false );
+
+    TEST_ASSERT( inc_srf.GetNumSectU() == full_srf.GetNumSectU() );
+    TEST_ASSERT( inc_srf.GetNumSectW() == full_srf.GetNumSectW() );
+    TEST_ASSERT_DELTA( inc_srf.GetUMax(), full_srf.GetUMax(), 1.0e-12 );
+    TEST_ASSERT_DELTA( inc_srf.GetWMax(), full_srf.GetWMax(), 1.0e-12 );
+
+    double max_pnt_err = 0.0;
+    double max_norm_err = 0.0;
+    int nu = 41;
+    int nv = 33;
+    for ( int i = 0 ; i < nu ; i++ )
+    {
+        double u = full_srf.GetUMax() * ( double )i / ( double )( nu - 1 );
+        for ( int j = 0 ; j < nv ; j++ )
+        {
+            double v = full_srf.GetWMax() * ( double )j / ( double )( nv - 1 );
+            max_pnt_err = std::max( max_pnt_err, dist( inc_srf.CompPnt( u, v ), full_srf.CompPnt( u, v ) ) );
+            max_norm_err = std::max( max_norm_err, dist( inc_srf.CompNorm( u, v ), full_srf.CompNorm( u, v ) ) );
+        }
+    }
+    TEST_ASSERT_DELTA( max_pnt_err, 0.0, 1.0e-12 );
+    TEST_ASSERT_DELTA( max_norm_err, 0.0, 1.0e-12 );
+
+    //==== Different Curve Breaks - Caller Must Fall Back To A Full Skin ====//
+    new_crv_vec[2] = MakeSkinSect( 2.0, 1.5, 6 );
+    TEST_ASSERT( !inc_srf.SkinC0Patches( new_crv_vec, changed_vec ) );
+}
+
 
 //==== WriteSurface =====//
 #if 0
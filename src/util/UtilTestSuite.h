@@ -33,6 +33,8 @@ public:
         TEST_ADD( UtilTestSuite::StlHelperTest )
         TEST_ADD( UtilTestSuite::VspCurveTest )
         TEST_ADD( UtilTestSuite::VspSurfTest )
+        TEST_ADD( UtilTestSuite::TessGridTest )
+        TEST_ADD( UtilTestSuite::SkinC0PatchesTest )
         TEST_ADD( UtilTestSuite::SharedPtrTest )
         TEST_ADD( UtilTestSuite::PointInPolyTest )
         TEST_ADD( UtilTestSuite::BilinearInterpTest )
@@ -45,6 +47,8 @@ private:
     void StlHelperTest();
     void VspCurveTest();
     void VspSurfTest();
+    void TessGridTest();
+    void SkinC0PatchesTest();
     void SharedPtrTest();
     void PointInPolyTest();
     void BilinearInterpTest();
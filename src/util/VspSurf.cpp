@@ -12,10 +12,12 @@
 #include <stdio.h>
 #include <math.h>
 #include <algorithm>
+#include <iterator>
 #include <set>
 
 #include "VspSurf.h"
 #include "StlHelper.h"
+#include "ThreadUtil.h"
 
 #include "eli/geom/curve/piecewise_creator.hpp"
 #include "eli/geom/surface/piecewise_body_of_revolution_creator.hpp"
@@ -333,6 +335,113 @@ void VspSurf::SkinC2( const vector< VspCurve > &input_crv_vec, bool closed_flag
     SkinCX( input_crv_vec, rib_data_type::C2, closed_flag );
 }
 
+//==== Each Span Of A C0 Skin Is Ruled Between Its Two Curves, So Only ====//
+//==== Spans Touching A Changed Curve Need Rebuilding.  Requires The    ====//
+//==== Same Number Of Curves And The Same Union Of Curve Breaks.       ====//
+bool VspSurf::SkinC0Patches( const vector< VspCurve > &input_crv_vec, const vector< bool > &changed_vec )
+{
+    int ncrv = ( int )input_crv_vec.size();
+    if ( ncrv < 2 || ( int )changed_vec.size() != ncrv || ( int )m_Surface.number_u_patches() != ncrv - 1 )
+    {
+        return false;
+    }
+
+    //==== Patch Breaks Along Curves Must Not Change ====//
+    vector< double > vpmap;
+    m_Surface.get_pmap_v( vpmap );
+
+    surface_tolerance_type tol;
+    vector< double > crv_pmap;
+    for ( int i = 0 ; i < ncrv ; i++ )
+    {
+        vector< double > pmap;
+        input_crv_vec[i].GetCurve().get_parameters( back_inserter( pmap ) );
+        crv_pmap.insert( crv_pmap.end(), pmap.begin(), pmap.end() );
+    }
+    sort( crv_pmap.begin(), crv_pmap.end() );
+
+    int nbreak = 0;
+    for ( int i = 0 ; i < ( int )crv_pmap.size() ; i++ )
+    {
+        if ( i > 0 && tol.approximately_equal( crv_pmap[i], crv_pmap[i - 1] ) )
+        {
+            continue;
+        }
+        if ( nbreak >= ( int )vpmap.size() || !tol.approximately_equal( crv_pmap[i], vpmap[nbreak] ) )
+        {
+            return false;
+        }
+        nbreak++;
+    }
+    if ( nbreak != ( int )vpmap.size() )
+    {
+        return false;
+    }
+
+    //==== Build New Spans Before Touching The Surface ====//
+    vector< int > span_vec;
+    vector< piecewise_surface_type > strip_vec;
+    for ( int i = 0 ; i < ncrv - 1 ; i++ )
+    {
+        if ( !changed_vec[i] && !changed_vec[i + 1] )
+        {
+            continue;
+        }
+
+        vector< VspCurve > pair_vec( 2 );
+        pair_vec[0] = input_crv_vec[i];
+        pair_vec[1] = input_crv_vec[i + 1];
+
+        VspSurf strip;
+        strip.SkinCX( pair_vec, rib_data_type::C0, false );
+
+        piecewise_surface_type & strip_surf = strip.m_Surface;
+        for ( int j = 1 ; j < ( int )vpmap.size() - 1 ; j++ )
+        {
+            strip_surf.split_v( vpmap[j] );
+        }
+
+        if ( strip_surf.number_u_patches() != 1 || strip_surf.number_v_patches() != m_Surface.number_v_patches() )
+        {
+            return false;
+        }
+
+        //==== Match Degree Of Full Skin Patches ====//
+        for ( int j = 0 ; j < ( int )m_Surface.number_v_patches() ; j++ )
+        {
+            surface_patch_type old_patch, new_patch;
+            m_Surface.get( old_patch, i, j );
+            strip_surf.get( new_patch, 0, j );
+
+            if ( new_patch.degree_u() > old_patch.degree_u() || new_patch.degree_v() > old_patch.degree_v() )
+            {
+                return false;
+            }
+            new_patch.promote_u_to( old_patch.degree_u() );
+            new_patch.promote_v_to( old_patch.degree_v() );
+            strip_surf.set( new_patch, 0, j );
+        }
+
+        span_vec.push_back( i );
+        strip_vec.push_back( strip_surf );
+    }
+
+    //==== Swap In Spans ====//
+    for ( int s = 0 ; s < ( int )span_vec.size() ; s++ )
+    {
+        for ( int j = 0 ; j < ( int )m_Surface.number_v_patches() ; j++ )
+        {
+            surface_patch_type patch;
+            strip_vec[s].get( patch, 0, j );
+            m_Surface.set( patch, span_vec[s], j );
+        }
+    }
+
+    ResetFlipNormal();
+    ResetUWSkip();
+    return true;
+}
+
 //===== Compute Point On Surf Given  U V (Between 0 1 ) =====//
 vec3d VspSurf::CompPnt01( double u, double v ) const
 {
@@ -548,7 +657,6 @@ void VspSurf::Tesselate( const vector<int> &num_u, int num_v, std::vector< vecto
     surface_index_type i, j, nu, nv( num_v );
     double umin, umax, vmin, vmax;
     std::vector<double> u, v( nv );
-    surface_point_type ptmp, ntmp;
 
     assert( num_u.size() == GetNumSectU() );
     assert( m_USkip.size() == GetNumSectU() );
@@ -605,23 +713,268 @@ void VspSurf::Tesselate( const vector<int> &num_u, int num_v, std::vector< vecto
     u.back() = uumin;
 
     // calculate the coordinate and normal at each point
-    for ( surface_index_type i = 0; i < nu; ++i )
+    vector< vec3d > pnt_grid, norm_grid;
+    TessGrid( u, v, pnt_grid, norm_grid );
+
+    for ( i = 0; i < nu; ++i )
+    {
+        std::copy( pnt_grid.begin() + i * nv, pnt_grid.begin() + ( i + 1 ) * nv, pnts[i].begin() );
+        std::copy( norm_grid.begin() + i * nv, norm_grid.begin() + ( i + 1 ) * nv, norms[i].begin() );
+        for ( j = 0; j < nv; ++j )
+        {
+            uw_pnts[i][j].set_xyz( u[i], v[j], 0.0 );
+        }
+    }
+}
+
+//==== Bernstein Basis Of Degree n And Its Derivative At t ====//
+static void BernsteinBasis( int n, double t, double* b, double* db )
+{
+    double s = 1.0 - t;
+
+    //==== Build Up To Degree n - 1 By De Casteljau Recurrence ====//
+    b[0] = 1.0;
+    for ( int k = 1 ; k < n ; k++ )
+    {
+        b[k] = t * b[k - 1];
+        for ( int i = k - 1 ; i > 0 ; i-- )
+        {
+            b[i] = s * b[i] + t * b[i - 1];
+        }
+        b[0] = s * b[0];
+    }
+
+    //==== Derivative From Degree n - 1 Basis ====//
+    if ( n == 0 )
+    {
+        db[0] = 0.0;
+        return;
+    }
+    db[0] = -n * b[0];
+    for ( int i = 1 ; i < n ; i++ )
+    {
+        db[i] = n * ( b[i - 1] - b[i] );
+    }
+    db[n] = n * b[n - 1];
+
+    //==== Raise To Degree n ====//
+    b[n] = t * b[n - 1];
+    for ( int i = n - 1 ; i > 0 ; i-- )
+    {
+        b[i] = s * b[i] + t * b[i - 1];
+    }
+    b[0] = s * b[0];
+}
+
+//==== Map Parameters To Patch Index And Local Parameter - Same Rules As Code-Eli ====//
+static void FindPatchParms( const vector< double > & pmap, const vector< double > & p, vector< int > & patch, vector< double > & local )
+{
+    surface_tolerance_type tol;
+    int npatch = ( int )pmap.size() - 1;
+
+    patch.resize( p.size() );
+    local.resize( p.size() );
+    for ( int i = 0 ; i < ( int )p.size() ; i++ )
+    {
+        int k = ( int )( std::upper_bound( pmap.begin(), pmap.end() - 1, p[i] ) - pmap.begin() ) - 1;
+        k = std::min( std::max( k, 0 ), npatch - 1 );
+
+        double t;
+        if ( tol.approximately_equal( p[i], pmap[k] ) )
+        {
+            t = 0.0;
+        }
+        else if ( tol.approximately_equal( p[i], pmap[k + 1] ) )
+        {
+            t = 1.0;
+        }
+        else
+        {
+            t = ( p[i] - pmap[k] ) / ( pmap[k + 1] - pmap[k] );
+            t = std::min( std::max( t, 0.0 ), 1.0 );
+        }
+
+        patch[i] = k;
+        local[i] = t;
+    }
+}
+
+//==== Evaluate One Patch At Local Grid ut x vt Using Basis Tables ====//
+static void TessPatch( const surface_patch_type & patch, const double* ut, int nut, const double* vt, int nvt,
+                       bool flip, int stride, vec3d* pnts, vec3d* norms )
+{
+    int nu = patch.degree_u();
+    int nv = patch.degree_v();
+    int nbu = nu + 1;
+    int nbv = nv + 1;
+
+    //==== Control Points As Flat Arrays ====//
+    vector< double > cp( nbu * nbv * 3 );
+    for ( int i = 0 ; i < nbu ; i++ )
+    {
+        for ( int j = 0 ; j < nbv ; j++ )
+        {
+            surface_patch_type::point_type p = patch.get_control_point( i, j );
+            double* c = &cp[ ( i * nbv + j ) * 3 ];
+            c[0] = p.x();
+            c[1] = p.y();
+            c[2] = p.z();
+        }
+    }
+
+    //==== Basis Tables In V ====//
+    vector< double > bv( nvt * nbv ), dbv( nvt * nbv );
+    for ( int b = 0 ; b < nvt ; b++ )
+    {
+        BernsteinBasis( nv, vt[b], &bv[ b * nbv ], &dbv[ b * nbv ] );
+    }
+
+    vector< double > bu( nbu ), dbu( nbu );
+    vector< double > q( nbv * 3 ), dq( nbv * 3 );
+    surface_tolerance_type tol;
+
+    for ( int a = 0 ; a < nut ; a++ )
     {
-        for ( surface_index_type j = 0; j < nv; ++j )
+        BernsteinBasis( nu, ut[a], &bu[0], &dbu[0] );
+
+        //==== Collapse U Direction - Curve Of Control Points In V ====//
+        for ( int k = 0 ; k < nbv * 3 ; k++ )
+        {
+            q[k] = 0.0;
+            dq[k] = 0.0;
+        }
+        for ( int i = 0 ; i < nbu ; i++ )
         {
-            ptmp = m_Surface.f( u[i], v[j] );
-            ntmp = m_Surface.normal( u[i], v[j] );
-            pnts[i][j].set_xyz( ptmp.x(), ptmp.y(), ptmp.z() );
-            if ( m_FlipNormal )
+            const double* c = &cp[ i * nbv * 3 ];
+            double w = bu[i];
+            double dw = dbu[i];
+            for ( int k = 0 ; k < nbv * 3 ; k++ )
             {
-                ntmp = -ntmp;
+                q[k] += w * c[k];
+                dq[k] += dw * c[k];
             }
-            norms[i][j].set_xyz( ntmp.x(), ntmp.y(), ntmp.z() );
-            uw_pnts[i][j].set_xyz( u[i], v[j], 0.0 );
+        }
+
+        for ( int b = 0 ; b < nvt ; b++ )
+        {
+            const double* w = &bv[ b * nbv ];
+            const double* dw = &dbv[ b * nbv ];
+
+            double f[3] = { 0.0, 0.0, 0.0 };
+            double fu[3] = { 0.0, 0.0, 0.0 };
+            double fv[3] = { 0.0, 0.0, 0.0 };
+            for ( int j = 0 ; j < nbv ; j++ )
+            {
+                for ( int d = 0 ; d < 3 ; d++ )
+                {
+                    f[d] += w[j] * q[ j * 3 + d ];
+                    fu[d] += w[j] * dq[ j * 3 + d ];
+                    fv[d] += dw[j] * q[ j * 3 + d ];
+                }
+            }
+
+            vec3d n( fu[1] * fv[2] - fu[2] * fv[1],
+                     fu[2] * fv[0] - fu[0] * fv[2],
+                     fu[0] * fv[1] - fu[1] * fv[0] );
+            double len = n.mag();
+
+            //==== Degenerate Point (Pole) - Code-Eli Uses Higher Order Terms ====//
+            if ( tol.approximately_equal( len, 0 ) )
+            {
+                surface_patch_type::point_type np = patch.normal( ut[a], vt[b] );
+                n.set_xyz( np.x(), np.y(), np.z() );
+            }
+            else
+            {
+                n = n / len;
+            }
+
+            if ( flip )
+            {
+                n = n * -1.0;
+            }
+
+            pnts[ a * stride + b ].set_xyz( f[0], f[1], f[2] );
+            norms[ a * stride + b ] = n;
         }
     }
 }
 
+//==== Tesselate Grid Patch By Patch, Blocks Of Patches Across Threads ====//
+void VspSurf::TessGrid( const vector< double > & u, const vector< double > & v, vector< vec3d > & pnts, vector< vec3d > & norms ) const
+{
+    int nu = ( int )u.size();
+    int nv = ( int )v.size();
+
+    pnts.resize( nu * nv );
+    norms.resize( nu * nv );
+
+    if ( nu == 0 || nv == 0 || m_Surface.number_u_patches() == 0 || m_Surface.number_v_patches() == 0 )
+    {
+        return;
+    }
+
+    //==== Locate Each Row And Column Once ====//
+    vector< double > upmap, vpmap;
+    m_Surface.get_pmap_uv( upmap, vpmap );
+
+    vector< int > upatch, vpatch;
+    vector< double > ut, vt;
+    FindPatchParms( upmap, u, upatch, ut );
+    FindPatchParms( vpmap, v, vpatch, vt );
+
+    //==== Runs Of Rows And Columns Falling In The Same Patch ====//
+    vector< int > urun( 1, 0 ), vrun( 1, 0 );
+    for ( int i = 1 ; i < nu ; i++ )
+    {
+        if ( upatch[i] != upatch[i - 1] )
+        {
+            urun.push_back( i );
+        }
+    }
+    urun.push_back( nu );
+    for ( int j = 1 ; j < nv ; j++ )
+    {
+        if ( vpatch[j] != vpatch[j - 1] )
+        {
+            vrun.push_back( j );
+        }
+    }
+    vrun.push_back( nv );
+
+    int nurun = ( int )urun.size() - 1;
+    int nvrun = ( int )vrun.size() - 1;
+
+    //==== Each Block Writes Its Own Part Of The Grid ====//
+    std::function< void( int, int ) > tess_block = [ & ]( int iblock, int ithread )
+    {
+        int ir = iblock / nvrun;
+        int jr = iblock % nvrun;
+        int i0 = urun[ir];
+        int j0 = vrun[jr];
+
+        surface_patch_type patch;
+        m_Surface.get( patch, upatch[i0], vpatch[j0] );
+
+        TessPatch( patch, &ut[i0], urun[ir + 1] - i0, &vt[j0], vrun[jr + 1] - j0,
+                   m_FlipNormal, nv, &pnts[ i0 * nv + j0 ], &norms[ i0 * nv + j0 ] );
+    };
+
+    //==== Threads Only Pay Off For Large Grids ====//
+    int nblock = nurun * nvrun;
+    if ( nu * nv < 8192 )
+    {
+        for ( int b = 0 ; b < nblock ; b++ )
+        {
+            tess_block( b, 0 );
+        }
+    }
+    else
+    {
+        ThreadUtil::ParallelFor( nblock, tess_block );
+    }
+}
+
 void VspSurf::TessUFeatureLine( int iu, int num_v, std::vector< vec3d > & pnts )
 {
     double u = m_UFeature[ iu ];
@@ -795,8 +1148,11 @@ bool VspSurf::CapWMax(int CapType)
 }
 
 
-void VspSurf::WriteBezFile( FILE* file_id, const std::string &geom_id, int surf_ind )
+//==== Convert To Cubic Bezier Sections Split At Feature Lines ====//
+void VspSurf::FetchBezSections( vector< BezSection > & sect_vec ) const
 {
+    sect_vec.clear();
+
     // Make copy for local changes.
     piecewise_surface_type s( m_Surface );
 
@@ -850,43 +1206,85 @@ void VspSurf::WriteBezFile( FILE* file_id, const std::string &geom_id, int surf_
       split_w.push_back( ClosestPatchEnd( w_pmap, m_WFeature[j] ) );
     }
 
-    int num_sections = ( split_u.size() - 1 ) * ( split_w.size() - 1 );
+    if ( split_u.size() < 2 || split_w.size() < 2 )
+    {
+        return;
+    }
 
-    fprintf( file_id, "%s Component\n", geom_id.c_str() );
-    fprintf( file_id, "%d  Num_Sections\n", num_sections );
-    fprintf( file_id, "%d Flip_Normal\n", m_FlipNormal );
+    sect_vec.resize( ( split_u.size() - 1 ) * ( split_w.size() - 1 ) );
 
+    int isect = 0;
     for ( int iu = 0 ; iu < ( int )split_u.size() - 1 ; iu++ )
     {
         for ( int iw = 0 ; iw < ( int )split_w.size() - 1 ; iw++ )
         {
-            //==== Write Section ====//
-            int num_u = split_u[iu + 1] - split_u[iu] + 1;
-            int num_w = split_w[iw + 1] - split_w[iw] + 1;
-            int num_u_map = split_u[iu + 1] / 3 - split_u[iu] / 3 + 1;
-            int num_w_map = split_w[iw + 1] / 3 - split_w[iw] / 3 + 1;
-            fprintf ( file_id, "%d %d  NumU, NumW\n", num_u, num_w );
-            fprintf( file_id, "%d %d NumU_Map, NumW_Map\n", num_u_map, num_w_map );
-            fprintf( file_id, "%d VspSurf_Index\n", surf_ind );
-            //==== Write U,W Mapping ====//
+            BezSection & sect = sect_vec[isect];
+            isect++;
+
+            //==== U,W Mapping ====//
             for ( int umi = split_u[iu] / 3; umi <= split_u[iu + 1] / 3; umi++ )
             {
-                fprintf( file_id, "%20.20lf\n", u_pmap[umi] );
+                sect.m_UMap.push_back( u_pmap[umi] );
             }
 
             for ( int wmi = split_w[iw] / 3; wmi <= split_w[iw + 1] / 3; wmi++ )
             {
-                fprintf( file_id, "%20.20lf\n", w_pmap[wmi] );
+                sect.m_WMap.push_back( w_pmap[wmi] );
             }
 
+            //==== Control Points ====//
+            sect.m_Pnts.resize( split_u[iu + 1] - split_u[iu] + 1 );
             for ( int i = split_u[iu] ; i <= split_u[iu + 1] ; i++ )
+            {
+                vector< vec3d > & row = sect.m_Pnts[ i - split_u[iu] ];
+                row.resize( split_w[iw + 1] - split_w[iw] + 1 );
                 for ( int j = split_w[iw] ; j <= split_w[iw + 1] ; j++ )
                 {
                     surface_patch_type::point_type p = pts[i][j];
-
-                    fprintf( file_id, "%20.20lf %20.20lf %20.20lf\n", p.x(), p.y(), p.z() );
+                    row[ j - split_w[iw] ].set_xyz( p.x(), p.y(), p.z() );
                 }
+            }
+        }
+    }
+}
+
+void VspSurf::WriteBezFile( FILE* file_id, const std::string &geom_id, int surf_ind )
+{
+    vector< BezSection > sect_vec;
+    FetchBezSections( sect_vec );
+
+    fprintf( file_id, "%s Component\n", geom_id.c_str() );
+    fprintf( file_id, "%d  Num_Sections\n", ( int )sect_vec.size() );
+    fprintf( file_id, "%d Flip_Normal\n", m_FlipNormal );
+
+    for ( int isect = 0 ; isect < ( int )sect_vec.size() ; isect++ )
+    {
+        const BezSection & sect = sect_vec[isect];
+
+        //==== Write Section ====//
+        int num_u = sect.m_Pnts.size();
+        int num_w = sect.m_Pnts[0].size();
+        fprintf ( file_id, "%d %d  NumU, NumW\n", num_u, num_w );
+        fprintf( file_id, "%d %d NumU_Map, NumW_Map\n", ( int )sect.m_UMap.size(), ( int )sect.m_WMap.size() );
+        fprintf( file_id, "%d VspSurf_Index\n", surf_ind );
+        //==== Write U,W Mapping ====//
+        for ( int umi = 0; umi < ( int )sect.m_UMap.size(); umi++ )
+        {
+            fprintf( file_id, "%20.20lf\n", sect.m_UMap[umi] );
         }
+
+        for ( int wmi = 0; wmi < ( int )sect.m_WMap.size(); wmi++ )
+        {
+            fprintf( file_id, "%20.20lf\n", sect.m_WMap[wmi] );
+        }
+
+        for ( int i = 0 ; i < num_u ; i++ )
+            for ( int j = 0 ; j < num_w ; j++ )
+            {
+                const vec3d & p = sect.m_Pnts[i][j];
+
+                fprintf( file_id, "%20.20lf %20.20lf %20.20lf\n", p.x(), p.y(), p.z() );
+            }
     }
 }
 
@@ -36,6 +36,15 @@ typedef eli::geom::surface::connection_data<double, 3, surface_tolerance_type> r
 #include <string>
 using std::vector;
 
+//==== Cubic Bezier Section Split At Feature Lines (BEZ File Section) ====//
+class BezSection
+{
+public:
+    vector< double > m_UMap;                    // Patch End U Values In VspSurf Parameter
+    vector< double > m_WMap;                    // Patch End W Values In VspSurf Parameter
+    vector< vector< vec3d > > m_Pnts;           // Control Points [3*nu+1][3*nw+1]
+};
+
 class VspSurf
 {
 public:
@@ -67,6 +76,9 @@ public:
     void SkinC1( const vector< VspCurve > &input_crv_vec, bool closed_flag );
     void SkinC2( const vector< VspCurve > &input_crv_vec, bool closed_flag );
 
+    //==== Re-Skin Only Sections Next To Changed Curves Of An Open C0 Skin - False If Full Skin Needed ====//
+    bool SkinC0Patches( const vector< VspCurve > &input_crv_vec, const vector< bool > &changed_vec );
+
     int GetNumSectU() const;
     int GetNumSectW() const;
 
@@ -131,6 +143,7 @@ public:
     bool CapUMax(int capType);
     bool CapWMin(int capType);
     bool CapWMax(int capType);
+    void FetchBezSections( vector< BezSection > & sect_vec ) const;
     void WriteBezFile( FILE* id, const std::string &geom_id, int surf_ind );
 
     void ResetUWSkip();
@@ -142,6 +155,9 @@ public:
     void Tesselate( const vector<int> &num_u, int num_v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms ) const;
     void Tesselate( const vector<int> &num_u, int num_v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
 
+    //===== Points And Normals At Every ( u[i], v[j] ) - Row Major, Index i * v.size() + j ====//
+    void TessGrid( const vector< double > & u, const vector< double > & v, std::vector< vec3d > & pnts, std::vector< vec3d > & norms ) const;
+
     void TessUFeatureLine( int iu, int num_v, std::vector< vec3d > & pnts );
     void TessWFeatureLine( int iw, int num_u, std::vector< vec3d > & pnts );
     void TessLine( double umin, double umax, double wmin, double wmax, int numpts, std::vector< vec3d > & pnts );